@@ -1382,6 +1382,23 @@ class V8_EXPORT ScriptCompiler {
    */
   static uint32_t CachedDataVersionTag();
 
+  /**
+   * Creates and returns a code cache for the specified unbound_script, which
+   * can be consumed later via kConsumeCodeCache. Unlike kProduceCodeCache,
+   * this can be called after the script has run, and the cache then also
+   * contains functions that have been compiled lazily in the meantime.
+   *
+   * This modifies the live script in the calling isolate: the inline caches,
+   * type feedback and optimized code maps of all its functions are cleared,
+   * so they have to warm up again afterwards.
+   *
+   * The script must have been compiled with kProduceCodeCache or
+   * kConsumeCodeCache. Returns NULL if the script cannot be serialized. The
+   * caller owns the returned CachedData.
+   */
+  static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script,
+                                     Local<String> source);
+
   /**
    * Compile an ES6 module.
    *
@@ -4948,6 +4965,18 @@ typedef void (*FailedAccessCheckCallback)(Local<Object> target,
  */
 typedef bool (*AllowCodeGenerationFromStringsCallback)(Local<Context> context);
 
+// --- Script Source Callback ---
+
+/**
+ * Callback to supply the source of a script whose source V8 has discarded,
+ * see Isolate::SetScriptSourceCallback. |script_id| and |resource_name| are
+ * the id and origin name of the script. The callback has to return exactly
+ * the source the script was compiled from, and must not call into
+ * JavaScript.
+ */
+typedef Local<String> (*ScriptSourceCallback)(Isolate* isolate, int script_id,
+                                              Local<Value> resource_name);
+
 // --- Garbage Collection Callbacks ---
 
 /**
@@ -5043,6 +5072,26 @@ class V8_EXPORT HeapObjectStatistics {
 };
 
 
+class V8_EXPORT CompilationCacheStatistics {
+ public:
+  CompilationCacheStatistics();
+  size_t hits() { return hits_; }
+  size_t misses() { return misses_; }
+  size_t evictions() { return evictions_; }
+  size_t cached_bytes() { return cached_bytes_; }
+  size_t budget() { return budget_; }
+
+ private:
+  size_t hits_;
+  size_t misses_;
+  size_t evictions_;
+  size_t cached_bytes_;
+  size_t budget_;
+
+  friend class Isolate;
+};
+
+
 class RetainedObjectInfo;
 
 
@@ -5184,7 +5233,8 @@ class V8_EXPORT Isolate {
           counter_lookup_callback(NULL),
           create_histogram_callback(NULL),
           add_histogram_sample_callback(NULL),
-          array_buffer_allocator(NULL) {}
+          array_buffer_allocator(NULL),
+          external_references(NULL) {}
 
     /**
      * The optional entry_hook allows the host application to provide the
@@ -5232,6 +5282,15 @@ class V8_EXPORT Isolate {
      * store of ArrayBuffers.
      */
     ArrayBuffer::Allocator* array_buffer_allocator;
+
+    /**
+     * Optional, null-terminated array of addresses of embedder functions,
+     * such as API callbacks, that are referenced from a custom startup
+     * snapshot. It must list the same addresses in the same order as the
+     * array passed to V8::CreateSnapshotDataBlob when the snapshot was
+     * created. The embedder owns the array.
+     */
+    intptr_t* external_references;
   };
 
 
@@ -5446,6 +5505,20 @@ class V8_EXPORT Isolate {
   bool GetHeapObjectStatisticsAtLastGC(HeapObjectStatistics* object_statistics,
                                        size_t type_index);
 
+  /**
+   * Get statistics about the compilation cache of scripts, evals and regular
+   * expressions. The byte counts only cover scripts and evals.
+   */
+  void GetCompilationCacheStatistics(
+      CompilationCacheStatistics* cache_statistics);
+
+  /**
+   * Limits the approximate number of bytes retained by cached scripts and
+   * evals. When the limit is exceeded, the least recently used entries are
+   * evicted. Passing 0 removes the limit, which is the default.
+   */
+  void SetCompilationCacheBudget(size_t max_bytes);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -5674,6 +5747,23 @@ class V8_EXPORT Isolate {
    */
   void SetPromiseRejectCallback(PromiseRejectCallback callback);
 
+  /**
+   * Allows V8 to discard the source of scripts which it no longer needs for
+   * compilation, i.e. of top-level scripts all of whose functions are
+   * compiled. Whenever the source of such a script is needed again, for
+   * instance to recompile a function or for Function.prototype.toString, V8
+   * requests it through |callback|. Sources are discarded on
+   * LowMemoryNotification and DiscardScriptSources.
+   */
+  void SetScriptSourceCallback(ScriptSourceCallback callback);
+
+  /**
+   * Discards the source of all scripts which can be recovered through the
+   * callback installed by SetScriptSourceCallback. Does nothing if no such
+   * callback is installed or while a debugger is active.
+   */
+  void DiscardScriptSources();
+
   /**
    * Experimental: Runs the Microtask Work Queue until empty
    * Any exceptions thrown by microtask callbacks are swallowed.
@@ -5911,6 +6001,14 @@ class V8_EXPORT StartupData {
 };
 
 
+/**
+ * Called by V8::CreateSnapshotDataBlob to let the embedder set up the context
+ * that is captured in the snapshot. Returns false on failure.
+ */
+typedef bool (*SnapshotInitializerCallback)(Isolate* isolate,
+                                            Local<Context> context);
+
+
 /**
  * EntropySource is used as a callback function when v8 needs a source
  * of entropy.
@@ -5984,6 +6082,18 @@ class V8_EXPORT V8 {
    */
   static StartupData CreateSnapshotDataBlob(const char* custom_source = NULL);
 
+  /**
+   * Like CreateSnapshotDataBlob(custom_source), but also calls |initializer|
+   * in the new context after |custom_source| has run, so that the embedder
+   * can install functions and accessors backed by native callbacks. The
+   * addresses of those callbacks must be listed in |external_references|,
+   * and the same list must be passed as CreateParams::external_references to
+   * every isolate created from the resulting snapshot.
+   */
+  static StartupData CreateSnapshotDataBlob(
+      const char* custom_source, intptr_t* external_references,
+      SnapshotInitializerCallback initializer);
+
   /**
    * Adds a message listener.
    *
@@ -410,11 +410,12 @@ void Accessors::ScriptSourceGetter(
     v8::Local<v8::Name> name,
     const v8::PropertyCallbackInfo<v8::Value>& info) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(info.GetIsolate());
-  DisallowHeapAllocation no_allocation;
   HandleScope scope(isolate);
   Object* object = *Utils::OpenHandle(*info.This());
-  Object* source = Script::cast(JSValue::cast(object)->value())->source();
-  info.GetReturnValue().Set(Utils::ToLocal(Handle<Object>(source, isolate)));
+  Handle<Script> script(Script::cast(JSValue::cast(object)->value()), isolate);
+  Script::EnsureSource(script);
+  Handle<Object> source(script->source(), isolate);
+  info.GetReturnValue().Set(Utils::ToLocal(source));
 }
 
 
@@ -22,6 +22,7 @@
 #include "src/bootstrapper.h"
 #include "src/char-predicates-inl.h"
 #include "src/code-stubs.h"
+#include "src/compilation-cache.h"
 #include "src/compiler.h"
 #include "src/context-measure.h"
 #include "src/contexts.h"
@@ -361,7 +362,15 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
 
 
 StartupData V8::CreateSnapshotDataBlob(const char* custom_source) {
+  return CreateSnapshotDataBlob(custom_source, NULL, NULL);
+}
+
+
+StartupData V8::CreateSnapshotDataBlob(
+    const char* custom_source, intptr_t* external_references,
+    SnapshotInitializerCallback initializer) {
   i::Isolate* internal_isolate = new i::Isolate(true);
+  internal_isolate->set_api_external_references(external_references);
   ArrayBufferAllocator allocator;
   internal_isolate->set_array_buffer_allocator(&allocator);
   Isolate* isolate = reinterpret_cast<Isolate*>(internal_isolate);
@@ -377,10 +386,16 @@ StartupData V8::CreateSnapshotDataBlob(const char* custom_source) {
       HandleScope handle_scope(isolate);
       Local<Context> new_context = Context::New(isolate);
       context.Reset(isolate, new_context);
-      if (custom_source != NULL) {
+      if (custom_source != NULL || initializer != NULL) {
         metadata.set_embeds_script(true);
         Context::Scope context_scope(new_context);
-        if (!RunExtraCode(isolate, new_context, custom_source)) context.Reset();
+        if (custom_source != NULL &&
+            !RunExtraCode(isolate, new_context, custom_source)) {
+          context.Reset();
+        } else if (initializer != NULL &&
+                   !initializer(isolate, new_context)) {
+          context.Reset();
+        }
       }
     }
     if (!context.IsEmpty()) {
@@ -2042,6 +2057,31 @@ uint32_t ScriptCompiler::CachedDataVersionTag() {
 }
 
 
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
+    Local<UnboundScript> unbound_script, Local<String> source) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  if (!i::FLAG_serialize_toplevel || !shared->is_toplevel() ||
+      !shared->script()->IsScript() ||
+      !i::Script::cast(shared->script())->has_serializable_code() ||
+      isolate->debug()->is_loaded()) {
+    return NULL;
+  }
+  LOG_API(isolate, "ScriptCompiler::CreateCodeCache");
+  ENTER_V8(isolate);
+  i::HandleScope handle_scope(isolate);
+  i::ScriptData* script_data = i::CodeSerializer::SerializeCompiledScript(
+      isolate, shared, Utils::OpenHandle(*source));
+  CachedData* result = new CachedData(
+      script_data->data(), script_data->length(), CachedData::BufferOwned);
+  script_data->ReleaseDataOwnership();
+  delete script_data;
+  return result;
+}
+
+
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source,
                                    ScriptOrigin* origin) {
   if (origin) {
@@ -2630,9 +2670,10 @@ MaybeLocal<Value> JSON::Parse(Isolate* v8_isolate, Local<String> json_string) {
   PREPARE_FOR_EXECUTION_WITH_ISOLATE(isolate, "JSON::Parse", Value);
   i::Handle<i::String> string = Utils::OpenHandle(*json_string);
   i::Handle<i::String> source = i::String::Flatten(string);
-  auto maybe = source->IsSeqOneByteString()
-                   ? i::JsonParser<true>::Parse(source)
-                   : i::JsonParser<false>::Parse(source);
+  bool one_byte =
+      source->IsSeqOneByteString() || source->IsExternalOneByteString();
+  auto maybe = one_byte ? i::JsonParser<true>::Parse(source)
+                        : i::JsonParser<false>::Parse(source);
   Local<Value> result;
   has_pending_exception = !ToLocal<Value>(maybe, &result);
   RETURN_ON_FAILED_EXECUTION(Value);
@@ -4953,15 +4994,38 @@ class Utf8WriterVisitor {
         fast_length = i + writable_length;
         if (fast_length > length) fast_length = length;
       }
-      // Write the characters to the stream.
+      // Write the characters to the stream. ASCII characters encode as
+      // themselves and never pair with the previous character, so runs of
+      // them are copied in bulk.
       if (sizeof(Char) == 1) {
-        for (; i < fast_length; i++) {
+        while (i < fast_length) {
+          int run = i::String::NonAsciiStart(
+              reinterpret_cast<const char*>(chars), fast_length - i);
+          i::CopyChars(buffer, chars, run);
+          buffer += run;
+          chars += run;
+          i += run;
+          if (i == fast_length) break;
           buffer +=
               Utf8::EncodeOneByte(buffer, static_cast<uint8_t>(*chars++));
+          i++;
           DCHECK(capacity_ == -1 || (buffer - start_) <= capacity_);
         }
       } else {
         for (; i < fast_length; i++) {
+          int run = 0;
+          while (i + run < fast_length &&
+                 chars[run] <= unibrow::Utf8::kMaxOneByteChar) {
+            run++;
+          }
+          if (run > 0) {
+            i::CopyChars(buffer, chars, run);
+            buffer += run;
+            chars += run;
+            i += run;
+            last_character = chars[-1];
+            if (i == fast_length) break;
+          }
           uint16_t character = *chars++;
           buffer += Utf8::Encode(buffer,
                                  character,
@@ -5399,6 +5463,10 @@ HeapObjectStatistics::HeapObjectStatistics()
       object_size_(0) {}
 
 
+CompilationCacheStatistics::CompilationCacheStatistics()
+    : hits_(0), misses_(0), evictions_(0), cached_bytes_(0), budget_(0) {}
+
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -7123,6 +7191,7 @@ Isolate* Isolate::New(const Isolate::CreateParams& params) {
   Isolate* v8_isolate = reinterpret_cast<Isolate*>(isolate);
   CHECK(params.array_buffer_allocator != NULL);
   isolate->set_array_buffer_allocator(params.array_buffer_allocator);
+  isolate->set_api_external_references(params.external_references);
   if (params.snapshot_blob != NULL) {
     isolate->set_snapshot_blob(params.snapshot_blob);
   } else {
@@ -7311,6 +7380,24 @@ bool Isolate::GetHeapObjectStatisticsAtLastGC(
 }
 
 
+void Isolate::GetCompilationCacheStatistics(
+    CompilationCacheStatistics* cache_statistics) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::CompilationCache* cache = isolate->compilation_cache();
+  cache_statistics->hits_ = cache->hits();
+  cache_statistics->misses_ = cache->misses();
+  cache_statistics->evictions_ = cache->evictions();
+  cache_statistics->cached_bytes_ = cache->CachedBytes();
+  cache_statistics->budget_ = cache->budget();
+}
+
+
+void Isolate::SetCompilationCacheBudget(size_t max_bytes) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->compilation_cache()->SetBudget(max_bytes);
+}
+
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -7347,6 +7434,19 @@ void Isolate::SetPromiseRejectCallback(PromiseRejectCallback callback) {
 }
 
 
+void Isolate::SetScriptSourceCallback(ScriptSourceCallback callback) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_script_source_callback(callback);
+}
+
+
+void Isolate::DiscardScriptSources() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8(isolate);
+  isolate->DiscardScriptSources();
+}
+
+
 void Isolate::RunMicrotasks() {
   reinterpret_cast<i::Isolate*>(this)->RunMicrotasks();
 }
@@ -7434,6 +7534,7 @@ void Isolate::LowMemoryNotification() {
         isolate->counters()->gc_low_memory_notification());
     isolate->heap()->CollectAllAvailableGarbage("low memory notification");
   }
+  isolate->DiscardScriptSources();
 }
 
 
@@ -18,6 +18,7 @@ const Register kReturnRegister0 = {kRegister_r0_Code};
 const Register kReturnRegister1 = {kRegister_r1_Code};
 const Register kJSFunctionRegister = {kRegister_r1_Code};
 const Register kContextRegister = {kRegister_r7_Code};
+const Register kInterpreterAccumulatorRegister = {kRegister_r0_Code};
 const Register kInterpreterBytecodeOffsetRegister = {kRegister_r5_Code};
 const Register kInterpreterBytecodeArrayRegister = {kRegister_r6_Code};
 const Register kInterpreterDispatchTableRegister = {kRegister_r8_Code};
@@ -635,6 +635,8 @@ function ArrayReverse() {
     %NormalizeElements(array);
     SparseReverse(array, len);
     return array;
+  } else if (isArray && !IS_UNDEFINED(%FastArrayReverse(array))) {
+    return array;
   } else if (isArray && %_HasFastPackedElements(array)) {
     return PackedArrayReverse(array, len);
   } else {
@@ -1401,6 +1403,10 @@ function InnerArrayIndexOf(element, index, length) {
   }
   var min = index;
   var max = length;
+  if (IS_ARRAY(this)) {
+    var result = %FastArrayIndexOf(this, element, min, max);
+    if (!IS_UNDEFINED(result)) return result;
+  }
   if (UseSparseVariant(this, length, IS_ARRAY(this), max - min)) {
     %NormalizeElements(this);
     var indices = %GetArrayKeys(this, length);
@@ -1462,6 +1468,10 @@ function InnerArrayLastIndexOf(element, index, length, argumentsLength) {
   }
   var min = 0;
   var max = index;
+  if (IS_ARRAY(this)) {
+    var result = %FastArrayLastIndexOf(this, element, min, max + 1);
+    if (!IS_UNDEFINED(result)) return result;
+  }
   if (UseSparseVariant(this, length, IS_ARRAY(this), index)) {
     %NormalizeElements(this);
     var indices = %GetArrayKeys(this, index + 1);
@@ -33,6 +33,9 @@ BackgroundParsingTask::BackgroundParsingTask(
   info->set_unicode_cache(&source_->unicode_cache);
   info->set_compile_options(options);
   info->set_allow_lazy_parsing(true);
+  if (FLAG_parse_streamed_functions_eagerly) {
+    info->set_eager_top_level_functions();
+  }
 }
 
 
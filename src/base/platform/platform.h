@@ -210,11 +210,16 @@ class OS {
 
   class MemoryMappedFile {
    public:
+    enum class FileMode { kReadOnly, kReadWrite };
+
     virtual ~MemoryMappedFile() {}
     virtual void* memory() const = 0;
     virtual size_t size() const = 0;
 
-    static MemoryMappedFile* open(const char* name);
+    // Read-only mappings are backed by the page cache and shared with every
+    // other process that maps the same file.
+    static MemoryMappedFile* open(const char* name,
+                                  FileMode mode = FileMode::kReadWrite);
     static MemoryMappedFile* create(const char* name, size_t size,
                                     void* initial);
   };
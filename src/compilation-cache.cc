@@ -24,7 +24,13 @@ CompilationCache::CompilationCache(Isolate* isolate)
       eval_global_(isolate, 1),
       eval_contextual_(isolate, 1),
       reg_exp_(isolate, kRegExpGenerations),
-      enabled_(true) {
+      enabled_(true),
+      use_clock_(0),
+      last_age_clock_(0),
+      budget_(0),
+      hits_(0),
+      misses_(0),
+      evictions_(0) {
   CompilationSubCache* subcaches[kSubCacheCount] =
     {&script_, &eval_global_, &eval_contextual_, &reg_exp_};
   for (int i = 0; i < kSubCacheCount; ++i) {
@@ -51,13 +57,20 @@ Handle<CompilationCacheTable> CompilationSubCache::GetTable(int generation) {
 }
 
 
-void CompilationSubCache::Age() {
+CompilationCacheTable* CompilationSubCache::PeekFirstTable() {
+  Object* table = tables_[kFirstGeneration];
+  if (table->IsUndefined()) return NULL;
+  return CompilationCacheTable::cast(table);
+}
+
+
+int CompilationSubCache::Age(int used_since) {
   // Don't directly age single-generation caches.
   if (generations_ == 1) {
     if (tables_[0] != isolate()->heap()->undefined_value()) {
-      CompilationCacheTable::cast(tables_[0])->Age();
+      return CompilationCacheTable::cast(tables_[0])->Age(used_since);
     }
-    return;
+    return 0;
   }
 
   // Age the generations implicitly killing off the oldest.
@@ -67,6 +80,7 @@ void CompilationSubCache::Age() {
 
   // Set the first generation as unborn.
   tables_[0] = isolate()->heap()->undefined_value();
+  return 0;
 }
 
 
@@ -142,7 +156,7 @@ bool CompilationCacheScript::HasOrigin(Handle<SharedFunctionInfo> function_info,
 Handle<SharedFunctionInfo> CompilationCacheScript::Lookup(
     Handle<String> source, Handle<Object> name, int line_offset,
     int column_offset, ScriptOriginOptions resource_options,
-    Handle<Context> context, LanguageMode language_mode) {
+    Handle<Context> context, LanguageMode language_mode, int use_stamp) {
   Object* result = NULL;
   int generation;
 
@@ -151,7 +165,8 @@ Handle<SharedFunctionInfo> CompilationCacheScript::Lookup(
   { HandleScope scope(isolate());
     for (generation = 0; generation < generations(); generation++) {
       Handle<CompilationCacheTable> table = GetTable(generation);
-      Handle<Object> probe = table->Lookup(source, context, language_mode);
+      Handle<Object> probe =
+          table->Lookup(source, context, language_mode, use_stamp);
       if (probe->IsSharedFunctionInfo()) {
         Handle<SharedFunctionInfo> function_info =
             Handle<SharedFunctionInfo>::cast(probe);
@@ -176,7 +191,9 @@ Handle<SharedFunctionInfo> CompilationCacheScript::Lookup(
         HasOrigin(shared, name, line_offset, column_offset, resource_options));
     // If the script was found in a later generation, we promote it to
     // the first generation to let it survive longer in the cache.
-    if (generation != 0) Put(source, context, language_mode, shared);
+    if (generation != 0) {
+      Put(source, context, language_mode, shared, use_stamp);
+    }
     isolate()->counters()->compilation_cache_hits()->Increment();
     return shared;
   } else {
@@ -189,17 +206,18 @@ Handle<SharedFunctionInfo> CompilationCacheScript::Lookup(
 void CompilationCacheScript::Put(Handle<String> source,
                                  Handle<Context> context,
                                  LanguageMode language_mode,
-                                 Handle<SharedFunctionInfo> function_info) {
+                                 Handle<SharedFunctionInfo> function_info,
+                                 int use_stamp) {
   HandleScope scope(isolate());
   Handle<CompilationCacheTable> table = GetFirstTable();
-  SetFirstTable(CompilationCacheTable::Put(table, source, context,
-                                           language_mode, function_info));
+  SetFirstTable(CompilationCacheTable::Put(
+      table, source, context, language_mode, function_info, use_stamp));
 }
 
 
 MaybeHandle<SharedFunctionInfo> CompilationCacheEval::Lookup(
     Handle<String> source, Handle<SharedFunctionInfo> outer_info,
-    LanguageMode language_mode, int scope_position) {
+    LanguageMode language_mode, int scope_position, int use_stamp) {
   HandleScope scope(isolate());
   // Make sure not to leak the table into the surrounding handle
   // scope. Otherwise, we risk keeping old tables around even after
@@ -208,15 +226,15 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheEval::Lookup(
   int generation;
   for (generation = 0; generation < generations(); generation++) {
     Handle<CompilationCacheTable> table = GetTable(generation);
-    result =
-        table->LookupEval(source, outer_info, language_mode, scope_position);
+    result = table->LookupEval(source, outer_info, language_mode,
+                               scope_position, use_stamp);
     if (result->IsSharedFunctionInfo()) break;
   }
   if (result->IsSharedFunctionInfo()) {
     Handle<SharedFunctionInfo> function_info =
         Handle<SharedFunctionInfo>::cast(result);
     if (generation != 0) {
-      Put(source, outer_info, function_info, scope_position);
+      Put(source, outer_info, function_info, scope_position, use_stamp);
     }
     isolate()->counters()->compilation_cache_hits()->Increment();
     return scope.CloseAndEscape(function_info);
@@ -230,11 +248,12 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheEval::Lookup(
 void CompilationCacheEval::Put(Handle<String> source,
                                Handle<SharedFunctionInfo> outer_info,
                                Handle<SharedFunctionInfo> function_info,
-                               int scope_position) {
+                               int scope_position, int use_stamp) {
   HandleScope scope(isolate());
   Handle<CompilationCacheTable> table = GetFirstTable();
   table = CompilationCacheTable::PutEval(table, source, outer_info,
-                                         function_info, scope_position);
+                                         function_info, scope_position,
+                                         use_stamp);
   SetFirstTable(table);
 }
 
@@ -291,8 +310,15 @@ MaybeHandle<SharedFunctionInfo> CompilationCache::LookupScript(
     Handle<Context> context, LanguageMode language_mode) {
   if (!IsEnabled()) return MaybeHandle<SharedFunctionInfo>();
 
-  return script_.Lookup(source, name, line_offset, column_offset,
-                        resource_options, context, language_mode);
+  Handle<SharedFunctionInfo> result =
+      script_.Lookup(source, name, line_offset, column_offset,
+                     resource_options, context, language_mode, NextUseStamp());
+  if (result.is_null()) {
+    misses_++;
+  } else {
+    hits_++;
+  }
+  return result;
 }
 
 
@@ -303,12 +329,17 @@ MaybeHandle<SharedFunctionInfo> CompilationCache::LookupEval(
 
   MaybeHandle<SharedFunctionInfo> result;
   if (context->IsNativeContext()) {
-    result =
-        eval_global_.Lookup(source, outer_info, language_mode, scope_position);
+    result = eval_global_.Lookup(source, outer_info, language_mode,
+                                 scope_position, NextUseStamp());
   } else {
     DCHECK(scope_position != RelocInfo::kNoPosition);
     result = eval_contextual_.Lookup(source, outer_info, language_mode,
-                                     scope_position);
+                                     scope_position, NextUseStamp());
+  }
+  if (result.is_null()) {
+    misses_++;
+  } else {
+    hits_++;
   }
   return result;
 }
@@ -318,7 +349,13 @@ MaybeHandle<FixedArray> CompilationCache::LookupRegExp(Handle<String> source,
                                                        JSRegExp::Flags flags) {
   if (!IsEnabled()) return MaybeHandle<FixedArray>();
 
-  return reg_exp_.Lookup(source, flags);
+  MaybeHandle<FixedArray> result = reg_exp_.Lookup(source, flags);
+  if (result.is_null()) {
+    misses_++;
+  } else {
+    hits_++;
+  }
+  return result;
 }
 
 
@@ -328,7 +365,8 @@ void CompilationCache::PutScript(Handle<String> source,
                                  Handle<SharedFunctionInfo> function_info) {
   if (!IsEnabled()) return;
 
-  script_.Put(source, context, language_mode, function_info);
+  script_.Put(source, context, language_mode, function_info, NextUseStamp());
+  EnforceBudget();
 }
 
 
@@ -341,11 +379,14 @@ void CompilationCache::PutEval(Handle<String> source,
 
   HandleScope scope(isolate());
   if (context->IsNativeContext()) {
-    eval_global_.Put(source, outer_info, function_info, scope_position);
+    eval_global_.Put(source, outer_info, function_info, scope_position,
+                     NextUseStamp());
   } else {
     DCHECK(scope_position != RelocInfo::kNoPosition);
-    eval_contextual_.Put(source, outer_info, function_info, scope_position);
+    eval_contextual_.Put(source, outer_info, function_info, scope_position,
+                         NextUseStamp());
   }
+  EnforceBudget();
 }
 
 
@@ -384,7 +425,76 @@ void CompilationCache::IterateFunctions(ObjectVisitor* v) {
 
 void CompilationCache::MarkCompactPrologue() {
   for (int i = 0; i < kSubCacheCount; i++) {
-    subcaches_[i]->Age();
+    evictions_ += subcaches_[i]->Age(last_age_clock_ + 1);
+  }
+  last_age_clock_ = use_clock_;
+}
+
+
+int CompilationCache::NextUseStamp() {
+  if (use_clock_ == Smi::kMaxValue) {
+    // Start over rather than let the stamps wrap around.
+    Clear();
+    use_clock_ = 0;
+    last_age_clock_ = 0;
+  }
+  return ++use_clock_;
+}
+
+
+void CompilationCache::SetBudget(size_t max_bytes) {
+  budget_ = max_bytes;
+  EnforceBudget();
+}
+
+
+size_t CompilationCache::CachedBytes() {
+  size_t bytes = 0;
+  for (int i = 0; i < kCodeSubCacheCount; i++) {
+    CompilationCacheTable* table = subcaches_[i]->PeekFirstTable();
+    if (table != NULL) bytes += table->LiveBytes();
+  }
+  return bytes;
+}
+
+
+namespace {
+
+struct EvictionCandidate {
+  int use_stamp;
+  CompilationCacheTable* table;
+  int entry;
+};
+
+
+int CompareUseStamps(const EvictionCandidate* a, const EvictionCandidate* b) {
+  return a->use_stamp - b->use_stamp;
+}
+
+}  // namespace
+
+
+void CompilationCache::EnforceBudget() {
+  if (budget_ == 0) return;
+  size_t bytes = CachedBytes();
+  if (bytes <= budget_) return;
+  DisallowHeapAllocation no_allocation;
+  List<EvictionCandidate> candidates;
+  for (int i = 0; i < kCodeSubCacheCount; i++) {
+    CompilationCacheTable* table = subcaches_[i]->PeekFirstTable();
+    if (table == NULL) continue;
+    for (int entry = 0; entry < table->Capacity(); entry++) {
+      if (!table->IsLiveEntry(entry)) continue;
+      EvictionCandidate candidate = {table->UseStampAt(entry), table, entry};
+      candidates.Add(candidate);
+    }
+  }
+  candidates.Sort(CompareUseStamps);
+  for (int i = 0; i < candidates.length() && bytes > budget_; i++) {
+    EvictionCandidate& victim = candidates[i];
+    bytes -= victim.table->EntrySizeAt(victim.entry);
+    victim.table->RemoveEntry(victim.entry);
+    evictions_++;
   }
 }
 
@@ -38,9 +38,14 @@ class CompilationSubCache {
     tables_[kFirstGeneration] = *value;
   }
 
+  // Returns the table of the first generation, or NULL if it is unborn.
+  CompilationCacheTable* PeekFirstTable();
+
   // Age the sub-cache by evicting the oldest generation and creating a new
-  // young generation.
-  void Age();
+  // young generation. Single-generation sub-caches instead evict their stale
+  // entries, keeping those used at or after |used_since|. Returns the number
+  // of evicted entries of single-generation sub-caches.
+  int Age(int used_since);
 
   // GC support.
   void Iterate(ObjectVisitor* v);
@@ -76,11 +81,11 @@ class CompilationCacheScript : public CompilationSubCache {
                                     int line_offset, int column_offset,
                                     ScriptOriginOptions resource_options,
                                     Handle<Context> context,
-                                    LanguageMode language_mode);
+                                    LanguageMode language_mode, int use_stamp);
   void Put(Handle<String> source,
            Handle<Context> context,
            LanguageMode language_mode,
-           Handle<SharedFunctionInfo> function_info);
+           Handle<SharedFunctionInfo> function_info, int use_stamp);
 
  private:
   bool HasOrigin(Handle<SharedFunctionInfo> function_info, Handle<Object> name,
@@ -111,10 +116,11 @@ class CompilationCacheEval: public CompilationSubCache {
   MaybeHandle<SharedFunctionInfo> Lookup(Handle<String> source,
                                          Handle<SharedFunctionInfo> outer_info,
                                          LanguageMode language_mode,
-                                         int scope_position);
+                                         int scope_position, int use_stamp);
 
   void Put(Handle<String> source, Handle<SharedFunctionInfo> outer_info,
-           Handle<SharedFunctionInfo> function_info, int scope_position);
+           Handle<SharedFunctionInfo> function_info, int scope_position,
+           int use_stamp);
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheEval);
@@ -194,7 +200,8 @@ class CompilationCache {
 
   // Notify the cache that a mark-sweep garbage collection is about to
   // take place. This is used to retire entries from the cache to
-  // avoid keeping them alive too long without using them.
+  // avoid keeping them alive too long without using them. Script and eval
+  // entries that were hit since the previous mark-sweep are kept.
   void MarkCompactPrologue();
 
   // Enable/disable compilation cache. Used by debugger to disable compilation
@@ -202,6 +209,21 @@ class CompilationCache {
   void Enable();
   void Disable();
 
+  // Limit the bytes retained by cached scripts and evals. When the limit is
+  // exceeded, the least recently used entries are evicted. Zero means no
+  // limit.
+  void SetBudget(size_t max_bytes);
+  size_t budget() const { return budget_; }
+
+  // The approximate number of bytes retained by cached scripts and evals, as
+  // accounted when the entries were stored.
+  size_t CachedBytes();
+
+  // Statistics since the creation of the isolate.
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+  size_t evictions() const { return evictions_; }
+
  private:
   explicit CompilationCache(Isolate* isolate);
   ~CompilationCache();
@@ -210,9 +232,19 @@ class CompilationCache {
 
   // The number of sub caches covering the different types to cache.
   static const int kSubCacheCount = 4;
+  // The number of sub caches holding shared function infos.
+  static const int kCodeSubCacheCount = 3;
 
   bool IsEnabled() { return FLAG_compilation_cache && enabled_; }
 
+  // Returns the stamp for the next use of a script or eval entry.
+  int NextUseStamp();
+
+  // Evict least recently used entries until the cache fits its budget. The
+  // live entries are scanned and sorted by use stamp once per call, and only
+  // if the budget is exceeded.
+  void EnforceBudget();
+
   Isolate* isolate() { return isolate_; }
 
   Isolate* isolate_;
@@ -226,6 +258,15 @@ class CompilationCache {
   // Current enable state of the compilation cache.
   bool enabled_;
 
+  // Clock for the use stamps of entries, and its value at the last aging.
+  int use_clock_;
+  int last_age_clock_;
+
+  size_t budget_;
+  size_t hits_;
+  size_t misses_;
+  size_t evictions_;
+
   friend class Isolate;
 
   DISALLOW_COPY_AND_ASSIGN(CompilationCache);
@@ -18,6 +18,7 @@
 #include "src/full-codegen/full-codegen.h"
 #include "src/gdb-jit.h"
 #include "src/hydrogen.h"
+#include "src/interpreter/interpreter.h"
 #include "src/lithium.h"
 #include "src/log-inl.h"
 #include "src/messages.h"
@@ -364,6 +365,23 @@ OptimizedCompileJob::Status OptimizedCompileJob::CreateGraph() {
     return AbortOptimization(kHydrogenFilter);
   }
 
+  // Interpreted functions can be optimized straight from their bytecode,
+  // which needs neither their AST nor full-codegen with deoptimization
+  // support. Deoptimizing back into the interpreter is not supported yet, so
+  // such code is built without deoptimization points.
+  if (info()->is_optimizing_from_bytecode()) {
+    DCHECK(!info()->is_deoptimization_enabled());
+    if (FLAG_trace_opt) {
+      OFStream os(stdout);
+      os << "[compiling method " << Brief(*info()->closure())
+         << " using TurboFan from bytecode]" << std::endl;
+    }
+    Timer t(this, &time_taken_to_create_graph_);
+    compiler::Pipeline pipeline(info());
+    pipeline.GenerateCode();
+    return SetLastStatus(info()->code().is_null() ? FAILED : SUCCEEDED);
+  }
+
   // Optimization requires a version of fullcode with deoptimization support.
   // Recompile the unoptimized version of the code if the current version
   // doesn't have deoptimization support already.
@@ -666,6 +684,30 @@ static bool CompileUnoptimizedCode(CompilationInfo* info) {
 }
 
 
+// Functions are only run by the interpreter when they are compiled lazily for
+// normal execution; debugging and deoptimization support need full-codegen.
+static bool ShouldUseIgnition(CompilationInfo* info) {
+  if (!FLAG_ignition || info->closure().is_null()) return false;
+  if (info->is_debug() || info->is_deoptimization_enabled()) return false;
+  if (info->will_serialize()) return false;
+  if (info->isolate()->debug()->is_active()) return false;
+  return info->closure()->PassesFilter(FLAG_ignition_filter);
+}
+
+
+static bool CompileUnoptimizedCodeOrBytecode(CompilationInfo* info) {
+  if (!ShouldUseIgnition(info)) return CompileUnoptimizedCode(info);
+  if (!Compiler::Analyze(info->parse_info()) ||
+      !(interpreter::Interpreter::MakeBytecode(info) ||
+        FullCodeGenerator::MakeCode(info))) {
+    Isolate* isolate = info->isolate();
+    if (!isolate->has_pending_exception()) isolate->StackOverflow();
+    return false;
+  }
+  return true;
+}
+
+
 MUST_USE_RESULT static MaybeHandle<Code> GetUnoptimizedCodeCommon(
     CompilationInfo* info) {
   VMState<COMPILER> state(info->isolate());
@@ -679,11 +721,22 @@ MUST_USE_RESULT static MaybeHandle<Code> GetUnoptimizedCodeCommon(
   SetExpectedNofPropertiesFromEstimate(shared, lit->expected_property_count());
   MaybeDisableOptimization(shared, lit->dont_optimize_reason());
 
+  // Lazily compiled functions of a script that produced a code cache can be
+  // included when the code cache is refreshed.
+  if (!info->script().is_null() && info->script()->has_serializable_code()) {
+    info->PrepareForSerializing();
+  }
+
   // Compile unoptimized code.
-  if (!CompileUnoptimizedCode(info)) return MaybeHandle<Code>();
+  if (!CompileUnoptimizedCodeOrBytecode(info)) return MaybeHandle<Code>();
 
-  CHECK_EQ(Code::FUNCTION, info->code()->kind());
-  RecordFunctionCompilation(Logger::LAZY_COMPILE_TAG, info, shared);
+  if (info->code().is_identical_to(
+          info->isolate()->builtins()->InterpreterEntryTrampoline())) {
+    DCHECK(shared->HasBytecodeArray());
+  } else {
+    CHECK_EQ(Code::FUNCTION, info->code()->kind());
+    RecordFunctionCompilation(Logger::LAZY_COMPILE_TAG, info, shared);
+  }
 
   // Update the shared function info with the scope info. Allocating the
   // ScopeInfo object may cause a GC.
@@ -784,8 +837,26 @@ bool Compiler::ParseAndAnalyze(ParseInfo* info) {
 }
 
 
+// Interpreted functions are optimized from their bytecode when enabled, which
+// avoids reparsing them.
+static bool ShouldOptimizeFromBytecode(CompilationInfo* info) {
+  return FLAG_turbo_from_bytecode && !info->is_osr() &&
+         info->shared_info()->HasBytecodeArray() &&
+         info->closure()->PassesFilter(FLAG_turbo_filter);
+}
+
+
+static bool ParseAndAnalyzeForOptimization(CompilationInfo* info) {
+  if (ShouldOptimizeFromBytecode(info)) {
+    info->MarkAsOptimizeFromBytecode();
+    return true;
+  }
+  return Compiler::ParseAndAnalyze(info->parse_info());
+}
+
+
 static bool GetOptimizedCodeNow(CompilationInfo* info) {
-  if (!Compiler::ParseAndAnalyze(info->parse_info())) return false;
+  if (!ParseAndAnalyzeForOptimization(info)) return false;
 
   TimerEventScope<TimerEventRecompileSynchronous> timer(info->isolate());
 
@@ -822,7 +893,7 @@ static bool GetOptimizedCodeLater(CompilationInfo* info) {
   }
 
   CompilationHandleScope handle_scope(info);
-  if (!Compiler::ParseAndAnalyze(info->parse_info())) return false;
+  if (!ParseAndAnalyzeForOptimization(info)) return false;
 
   // Reopen handles in the new CompilationHandleScope.
   info->ReopenHandlesInNewHandleScope();
@@ -1353,6 +1424,7 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
     if (FLAG_serialize_toplevel &&
         compile_options == ScriptCompiler::kProduceCodeCache) {
       info.PrepareForSerializing();
+      script->set_has_serializable_code(true);
     }
 
     parse_info.set_language_mode(
@@ -131,6 +131,7 @@ class CompilationInfo {
     kDeoptimizationEnabled = 1 << 15,
     kSourcePositionsEnabled = 1 << 16,
     kFirstCompile = 1 << 17,
+    kOptimizeFromBytecode = 1 << 18,
   };
 
   explicit CompilationInfo(ParseInfo* parse_info);
@@ -231,6 +232,12 @@ class CompilationInfo {
 
   void MarkAsTypeFeedbackEnabled() { SetFlag(kTypeFeedbackEnabled); }
 
+  void MarkAsOptimizeFromBytecode() { SetFlag(kOptimizeFromBytecode); }
+
+  bool is_optimizing_from_bytecode() const {
+    return GetFlag(kOptimizeFromBytecode);
+  }
+
   bool is_type_feedback_enabled() const {
     return GetFlag(kTypeFeedbackEnabled);
   }
@@ -121,6 +121,14 @@ FieldAccess AccessBuilder::ForMapInstanceType() {
 }
 
 
+// static
+FieldAccess AccessBuilder::ForHeapNumberValue() {
+  FieldAccess access = {kTaggedBase, HeapNumber::kValueOffset,
+                        MaybeHandle<Name>(), Type::Number(), kMachFloat64};
+  return access;
+}
+
+
 // static
 FieldAccess AccessBuilder::ForStringLength(Zone* zone) {
   FieldAccess access = {
@@ -58,6 +58,10 @@ class AccessBuilder final : public AllStatic {
   // Provides access to Map::instance_type() field.
   static FieldAccess ForMapInstanceType();
 
+  // Provides access to HeapNumber::value() field, which is also used for the
+  // MutableHeapNumber boxes of double fields that are not unboxed.
+  static FieldAccess ForHeapNumberValue();
+
   // Provides access to String::length() field.
   static FieldAccess ForStringLength(Zone* zone);
 
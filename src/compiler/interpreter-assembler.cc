@@ -30,6 +30,8 @@ InterpreterAssembler::InterpreterAssembler(Isolate* isolate, Zone* zone,
           isolate, new (zone) Graph(zone),
           Linkage::GetInterpreterDispatchDescriptor(zone), kMachPtr,
           InstructionSelector::SupportedMachineOperatorFlags())),
+      accumulator_(
+          raw_assembler_->Parameter(Linkage::kInterpreterAccumulatorParameter)),
       end_node_(nullptr),
       code_generated_(false) {}
 
@@ -60,6 +62,12 @@ Handle<Code> InterpreterAssembler::GenerateCode() {
 }
 
 
+Node* InterpreterAssembler::GetAccumulator() { return accumulator_; }
+
+
+void InterpreterAssembler::SetAccumulator(Node* value) { accumulator_ = value; }
+
+
 Node* InterpreterAssembler::BytecodeArrayPointer() {
   return raw_assembler_->Parameter(Linkage::kInterpreterBytecodeArrayParameter);
 }
@@ -103,6 +111,37 @@ Node* InterpreterAssembler::BytecodeOperand(int delta) {
 }
 
 
+Node* InterpreterAssembler::BytecodeOperandImm8(int delta) {
+  DCHECK_LT(delta, interpreter::Bytecodes::NumberOfOperands(bytecode_));
+  DCHECK_EQ(interpreter::OperandType::kImm8,
+            interpreter::Bytecodes::GetOperandType(bytecode_, delta));
+  Node* load = raw_assembler_->Load(
+      kMachInt8, BytecodeArrayPointer(),
+      raw_assembler_->IntPtrAdd(BytecodeOffset(), Int32Constant(1 + delta)));
+  // Ensure that we sign extend to full pointer size.
+  if (kPointerSize == 8) {
+    load = raw_assembler_->ChangeInt32ToInt64(load);
+  }
+  return load;
+}
+
+
+Node* InterpreterAssembler::BytecodeOperandReg(int delta) {
+  DCHECK_LT(delta, interpreter::Bytecodes::NumberOfOperands(bytecode_));
+  DCHECK_EQ(interpreter::OperandType::kReg,
+            interpreter::Bytecodes::GetOperandType(bytecode_, delta));
+  // Register operands hold the negated register index as a signed byte (see
+  // interpreter::Register::ToOperand).
+  Node* load = raw_assembler_->Load(
+      kMachInt8, BytecodeArrayPointer(),
+      raw_assembler_->IntPtrAdd(BytecodeOffset(), Int32Constant(1 + delta)));
+  if (kPointerSize == 8) {
+    load = raw_assembler_->ChangeInt32ToInt64(load);
+  }
+  return raw_assembler_->IntPtrSub(Int32Constant(0), load);
+}
+
+
 Node* InterpreterAssembler::LoadRegister(int index) {
   return raw_assembler_->Load(kMachPtr, FramePointer(),
                               RegisterFrameOffset(index));
@@ -127,18 +166,25 @@ Node* InterpreterAssembler::StoreRegister(Node* value, Node* index) {
 }
 
 
+Node* InterpreterAssembler::SmiTag(Node* value) {
+  return raw_assembler_->WordShl(value,
+                                 Int32Constant(kSmiShiftSize + kSmiTagSize));
+}
+
+
 void InterpreterAssembler::Return() {
   Node* exit_trampoline_code_object =
       HeapConstant(Unique<HeapObject>::CreateImmovable(
           isolate()->builtins()->InterpreterExitTrampoline()));
   // If the order of the parameters you need to change the call signature below.
-  STATIC_ASSERT(0 == Linkage::kInterpreterBytecodeOffsetParameter);
-  STATIC_ASSERT(1 == Linkage::kInterpreterBytecodeArrayParameter);
-  STATIC_ASSERT(2 == Linkage::kInterpreterDispatchTableParameter);
+  STATIC_ASSERT(0 == Linkage::kInterpreterAccumulatorParameter);
+  STATIC_ASSERT(1 == Linkage::kInterpreterBytecodeOffsetParameter);
+  STATIC_ASSERT(2 == Linkage::kInterpreterBytecodeArrayParameter);
+  STATIC_ASSERT(3 == Linkage::kInterpreterDispatchTableParameter);
   Node* tail_call = graph()->NewNode(
       common()->TailCall(call_descriptor()), exit_trampoline_code_object,
-      BytecodeOffset(), BytecodeArrayPointer(), DispatchTablePointer(),
-      graph()->start(), graph()->start());
+      GetAccumulator(), BytecodeOffset(), BytecodeArrayPointer(),
+      DispatchTablePointer(), graph()->start(), graph()->start());
   schedule()->AddTailCall(raw_assembler_->CurrentBlock(), tail_call);
   // This should always be the end node.
   SetEndInput(tail_call);
@@ -163,13 +209,14 @@ void InterpreterAssembler::Dispatch() {
                                 Int32Constant(kPointerSizeLog2)));
 
   // If the order of the parameters you need to change the call signature below.
-  STATIC_ASSERT(0 == Linkage::kInterpreterBytecodeOffsetParameter);
-  STATIC_ASSERT(1 == Linkage::kInterpreterBytecodeArrayParameter);
-  STATIC_ASSERT(2 == Linkage::kInterpreterDispatchTableParameter);
+  STATIC_ASSERT(0 == Linkage::kInterpreterAccumulatorParameter);
+  STATIC_ASSERT(1 == Linkage::kInterpreterBytecodeOffsetParameter);
+  STATIC_ASSERT(2 == Linkage::kInterpreterBytecodeArrayParameter);
+  STATIC_ASSERT(3 == Linkage::kInterpreterDispatchTableParameter);
   Node* tail_call = graph()->NewNode(
       common()->TailCall(call_descriptor()), target_code_object,
-      new_bytecode_offset, BytecodeArrayPointer(), DispatchTablePointer(),
-      graph()->start(), graph()->start());
+      GetAccumulator(), new_bytecode_offset, BytecodeArrayPointer(),
+      DispatchTablePointer(), graph()->start(), graph()->start());
   schedule()->AddTailCall(raw_assembler_->CurrentBlock(), tail_call);
   // This should always be the end node.
   SetEndInput(tail_call);
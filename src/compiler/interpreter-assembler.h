@@ -46,12 +46,27 @@ class InterpreterAssembler {
   // Returns the bytecode operand |index| for the current bytecode.
   Node* BytecodeOperand(int index);
 
+  // Returns the Imm8 immediate for bytecode operand |index| in the current
+  // bytecode, sign extended to word size.
+  Node* BytecodeOperandImm8(int index);
+
+  // Returns the index of the register in bytecode operand |index| in the
+  // current bytecode.
+  Node* BytecodeOperandReg(int index);
+
+  // Accumulator.
+  Node* GetAccumulator();
+  void SetAccumulator(Node* value);
+
   // Loads from and stores to the interpreter register file.
   Node* LoadRegister(int index);
   Node* LoadRegister(Node* index);
   Node* StoreRegister(Node* value, int index);
   Node* StoreRegister(Node* value, Node* index);
 
+  // Returns a tagged Smi for the word sized integer |value|.
+  Node* SmiTag(Node* value);
+
   // Returns from the function.
   void Return();
 
@@ -101,6 +116,7 @@ class InterpreterAssembler {
 
   interpreter::Bytecode bytecode_;
   base::SmartPointer<RawMachineAssembler> raw_assembler_;
+  Node* accumulator_;
   Node* end_node_;
   bool code_generated_;
 
@@ -77,8 +77,14 @@ static void AddFieldAccessTypes(FieldAccess* access,
 }
 
 
+// Computes the access to an in-object field of {map}. Double fields that are
+// not unboxed hold a MutableHeapNumber; for those {access} describes the load
+// of the box and {is_boxed_double} is set, so the caller has to go through
+// AccessBuilder::ForHeapNumberValue() to reach the actual value.
 static bool GetInObjectFieldAccess(LoadOrStore mode, Handle<Map> map,
-                                   Handle<Name> name, FieldAccess* access) {
+                                   Handle<Name> name, FieldAccess* access,
+                                   bool* is_boxed_double) {
+  *is_boxed_double = false;
   access->base_is_tagged = kTaggedBase;
   access->offset = -1;
   access->name = name;
@@ -116,8 +122,8 @@ static bool GetInObjectFieldAccess(LoadOrStore mode, Handle<Map> map,
       // TODO(turbofan): deopt, ignore or throw on readonly stores.
       return false;
     }
-    if (is_smi || is_double) {
-      // TODO(turbofan): check type and deopt for SMI/double stores.
+    if (is_smi) {
+      // TODO(turbofan): check type and deopt for SMI stores.
       return false;
     }
   }
@@ -127,8 +133,9 @@ static bool GetInObjectFieldAccess(LoadOrStore mode, Handle<Map> map,
 
   if (field_index.is_inobject()) {
     if (is_double && !map->IsUnboxedDoubleField(field_index)) {
-      // TODO(turbofan): support for out-of-line (MutableHeapNumber) loads.
-      return false;
+      access->type = Type::Internal();
+      access->machine_type = kMachAnyTagged;
+      *is_boxed_double = true;
     }
     access->offset = field_index.offset();
     return true;
@@ -157,15 +164,23 @@ Reduction JSTypeFeedbackSpecializer::ReduceJSLoadNamed(Node* node) {
   }
   oracle()->PropertyReceiverTypes(slot, name, &maps);
 
-  Node* receiver = node->InputAt(0);
-  Node* effect = NodeProperties::GetEffectInput(node);
-
   if (maps.length() != 1) return NoChange();  // TODO(turbofan): polymorphism
   if (!ENABLE_FAST_PROPERTY_LOADS) return NoChange();
 
-  Handle<Map> map = maps.first();
+  return LowerLoadNamedField(node, maps.first(), name, frame_state_before);
+}
+
+
+Reduction JSTypeFeedbackSpecializer::LowerLoadNamedField(
+    Node* node, Handle<Map> map, Handle<Name> name, Node* frame_state_before) {
+  DCHECK(node->opcode() == IrOpcode::kJSLoadNamed);
+  Node* receiver = node->InputAt(0);
+  Node* effect = NodeProperties::GetEffectInput(node);
+
   FieldAccess field_access;
-  if (!GetInObjectFieldAccess(LOAD, map, name, &field_access)) {
+  bool is_boxed_double;
+  if (!GetInObjectFieldAccess(LOAD, map, name, &field_access,
+                              &is_boxed_double)) {
     return NoChange();
   }
 
@@ -178,6 +193,11 @@ Reduction JSTypeFeedbackSpecializer::ReduceJSLoadNamed(Node* node) {
   // Build the actual load.
   Node* load = graph()->NewNode(simplified()->LoadField(field_access), receiver,
                                 effect, check_success);
+  if (is_boxed_double) {
+    load = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForHeapNumberValue()), load,
+        load, check_success);
+  }
 
   // TODO(turbofan): handle slow case instead of deoptimizing.
   Node* deopt = graph()->NewNode(common()->Deoptimize(), frame_state_before,
@@ -278,16 +298,35 @@ Reduction JSTypeFeedbackSpecializer::ReduceJSStoreNamed(Node* node) {
     oracle()->AssignmentReceiverTypes(id, name, &maps);
   }
 
-  Node* receiver = node->InputAt(0);
-  Node* effect = NodeProperties::GetEffectInput(node);
-
   if (maps.length() != 1) return NoChange();  // TODO(turbofan): polymorphism
 
   if (!ENABLE_FAST_PROPERTY_STORES) return NoChange();
 
-  Handle<Map> map = maps.first();
+  return LowerStoreNamedField(node, maps.first(), name, frame_state_before);
+}
+
+
+Reduction JSTypeFeedbackSpecializer::LowerStoreNamedField(
+    Node* node, Handle<Map> map, Handle<Name> name, Node* frame_state_before) {
+  DCHECK(node->opcode() == IrOpcode::kJSStoreNamed);
+  Node* receiver = node->InputAt(0);
+  Node* effect = NodeProperties::GetEffectInput(node);
+
   FieldAccess field_access;
-  if (!GetInObjectFieldAccess(STORE, map, name, &field_access)) {
+  bool is_boxed_double;
+  if (!GetInObjectFieldAccess(STORE, map, name, &field_access,
+                              &is_boxed_double)) {
+    return NoChange();
+  }
+
+  // Stores to double fields write the raw float64, so the value has to be
+  // known to be a number.
+  Node* value = node->InputAt(1);
+  bool is_double = is_boxed_double || field_access.machine_type == kMachFloat64;
+  if (is_double && (!NodeProperties::IsTyped(value) ||
+                    !NodeProperties::GetBounds(value).upper->Is(
+                        Type::Number()))) {
+    // TODO(turbofan): check type and deopt for double stores.
     return NoChange();
   }
 
@@ -297,10 +336,19 @@ Reduction JSTypeFeedbackSpecializer::ReduceJSStoreNamed(Node* node) {
   BuildMapCheck(receiver, map, true, effect, control, &check_success,
                 &check_failed);
 
-  // Build the actual load.
-  Node* value = node->InputAt(1);
-  Node* store = graph()->NewNode(simplified()->StoreField(field_access),
-                                 receiver, value, effect, check_success);
+  // Build the actual store. Boxed doubles are updated in place, the
+  // MutableHeapNumber is owned by the receiver.
+  Node* store;
+  if (is_boxed_double) {
+    Node* box = graph()->NewNode(simplified()->LoadField(field_access),
+                                 receiver, effect, check_success);
+    store = graph()->NewNode(
+        simplified()->StoreField(AccessBuilder::ForHeapNumberValue()), box,
+        value, box, check_success);
+  } else {
+    store = graph()->NewNode(simplified()->StoreField(field_access), receiver,
+                             value, effect, check_success);
+  }
 
   // TODO(turbofan): handle slow case instead of deoptimizing.
   Node* deopt = graph()->NewNode(common()->Deoptimize(), frame_state_before,
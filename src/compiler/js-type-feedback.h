@@ -90,6 +90,13 @@ class JSTypeFeedbackSpecializer : public AdvancedReducer {
   Reduction ReduceJSStoreNamed(Node* node);
   Reduction ReduceJSStoreProperty(Node* node);
 
+  // Lower a named load or store on a receiver with the given {map} to a map
+  // check and an in-object field access. Visible for unit testing.
+  Reduction LowerLoadNamedField(Node* node, Handle<Map> map, Handle<Name> name,
+                                Node* frame_state_before);
+  Reduction LowerStoreNamedField(Node* node, Handle<Map> map,
+                                 Handle<Name> name, Node* frame_state_before);
+
  private:
   JSGraph* jsgraph_;
   SimplifiedOperatorBuilder simplified_;
@@ -12,6 +12,7 @@
 #include "src/compiler/ast-graph-builder.h"
 #include "src/compiler/ast-loop-assignment-analyzer.h"
 #include "src/compiler/basic-block-instrumentor.h"
+#include "src/compiler/bytecode-graph-builder.h"
 #include "src/compiler/change-lowering.h"
 #include "src/compiler/code-generator.h"
 #include "src/compiler/common-operator-reducer.h"
@@ -350,6 +351,9 @@ base::SmartArrayPointer<char> GetDebugName(CompilationInfo* info) {
     base::SmartArrayPointer<char> name(new char[len]);
     memcpy(name.get(), major_name, len);
     return name;
+  } else if (info->function() == nullptr) {
+    AllowHandleDereference allow_deref;
+    return info->shared_info()->DebugName()->ToCString();
   } else {
     AllowHandleDereference allow_deref;
     return info->function()->debug_name()->ToCString();
@@ -479,11 +483,21 @@ struct GraphBuilderPhase {
   static const char* phase_name() { return "graph builder"; }
 
   void Run(PipelineData* data, Zone* temp_zone) {
-    AstGraphBuilderWithPositions graph_builder(
-        temp_zone, data->info(), data->jsgraph(), data->loop_assignment(),
-        data->js_type_feedback(), data->source_positions());
     bool stack_check = !data->info()->IsStub();
-    if (!graph_builder.CreateGraph(stack_check)) {
+    bool succeeded = false;
+
+    if (data->info()->is_optimizing_from_bytecode()) {
+      BytecodeGraphBuilder graph_builder(temp_zone, data->info(),
+                                         data->jsgraph());
+      succeeded = graph_builder.CreateGraph(stack_check);
+    } else {
+      AstGraphBuilderWithPositions graph_builder(
+          temp_zone, data->info(), data->jsgraph(), data->loop_assignment(),
+          data->js_type_feedback(), data->source_positions());
+      succeeded = graph_builder.CreateGraph(stack_check);
+    }
+
+    if (!succeeded) {
       data->set_compilation_failed();
     }
   }
@@ -1013,7 +1027,8 @@ Handle<Code> Pipeline::GenerateCode() {
       int pos = info()->shared_info()->start_position();
       json_of << "{\"function\":\"" << function_name.get()
               << "\", \"sourcePosition\":" << pos << ", \"source\":\"";
-      if (!script->IsUndefined() && !script->source()->IsUndefined()) {
+      if (function != nullptr && !script->IsUndefined() &&
+          !script->source()->IsUndefined()) {
         DisallowHeapAllocation no_allocation;
         int start = function->start_position();
         int len = function->end_position() - start;
@@ -1049,7 +1064,7 @@ Handle<Code> Pipeline::GenerateCode() {
 
   data.source_positions()->AddDecorator();
 
-  if (FLAG_loop_assignment_analysis) {
+  if (FLAG_loop_assignment_analysis && !info()->is_optimizing_from_bytecode()) {
     Run<LoopAssignmentAnalysisPhase>();
   }
 
@@ -119,12 +119,37 @@ double StringToInt(UnicodeCache* unicode_cache,
 }
 
 
+// Integers of smaller magnitude are exactly representable as doubles.
+static const double kMaxExactInteger = 9007199254740992.0;  // 2^53
+
+
+// Like IntToCString, for integers of magnitude below kMaxExactInteger.
+static const char* ExactIntegerToCString(int64_t n, Vector<char> buffer) {
+  bool negative = n < 0;
+  uint64_t magnitude = negative ? -n : n;
+  // Build the string backwards from the least significant digit.
+  int i = buffer.length();
+  buffer[--i] = '\0';
+  do {
+    buffer[--i] = '0' + (magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude);
+  if (negative) buffer[--i] = '-';
+  return buffer.start() + i;
+}
+
+
 const char* DoubleToCString(double v, Vector<char> buffer) {
   switch (fpclassify(v)) {
     case FP_NAN: return "NaN";
     case FP_INFINITE: return (v < 0.0 ? "-Infinity" : "Infinity");
     case FP_ZERO: return "0";
     default: {
+      // Integers below 2^53 are exact, so their shortest representation is
+      // simply their decimal digits.
+      if (std::fabs(v) < kMaxExactInteger && v == std::floor(v)) {
+        return ExactIntegerToCString(static_cast<int64_t>(v), buffer);
+      }
       SimpleStringBuilder builder(buffer.start(), buffer.length());
       int decimal_point;
       int sign;
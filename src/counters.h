@@ -557,6 +557,12 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(normalized_maps, V8.NormalizedMaps)                              \
   SC(props_to_dictionary, V8.ObjectPropertiesToDictionary)            \
   SC(elements_to_dictionary, V8.ObjectElementsToDictionary)           \
+  /* Elements kind transitions that need a new backing store, the */  \
+  /* bytes they allocate and those done in place instead. */          \
+  SC(elements_transitions_copying, V8.ElementsTransitionsCopying)     \
+  SC(elements_transitions_copied_bytes,                               \
+     V8.ElementsTransitionsCopiedBytes)                               \
+  SC(elements_transitions_in_place, V8.ElementsTransitionsInPlace)    \
   SC(alive_after_last_gc, V8.AliveAfterLastGC)                        \
   SC(objs_since_last_young, V8.ObjsSinceLastYoung)                    \
   SC(objs_since_last_full, V8.ObjsSinceLastFull)                      \
@@ -571,6 +577,8 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                        \
   SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
+  SC(descriptor_lookup_cache_hits, V8.DescriptorLookupCacheHits)      \
+  SC(descriptor_lookup_cache_misses, V8.DescriptorLookupCacheMisses)  \
   SC(string_ctor_calls, V8.StringConstructorCalls)                    \
   SC(string_ctor_conversions, V8.StringConstructorConversions)        \
   SC(string_ctor_cached_number, V8.StringConstructorCachedNumber)     \
@@ -584,6 +592,8 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(total_parse_size, V8.TotalParseSize)                             \
   /* Amount of source code skipped over using preparsing. */          \
   SC(total_preparse_skipped, V8.TotalPreparseSkipped)                 \
+  /* Number of function bodies skipped over using preparsing. */      \
+  SC(total_preparsed_functions, V8.TotalPreparsedFunctions)           \
   /* Number of symbol lookups skipped using preparsing */             \
   SC(total_preparse_symbols_skipped, V8.TotalPreparseSymbolSkipped)   \
   /* Amount of compiled source code. */                               \
@@ -842,6 +842,7 @@ MaybeHandle<JSArray> LiveEdit::GatherCompileInfo(Handle<Script> script,
   Handle<Object> original_source =
       Handle<Object>(script->source(), isolate);
   script->set_source(*source);
+  script->set_preparse_data(isolate->heap()->undefined_value());
   isolate->set_active_function_info_listener(&listener);
 
   {
@@ -891,6 +892,8 @@ MaybeHandle<JSArray> LiveEdit::GatherCompileInfo(Handle<Script> script,
   // A logical 'finally' section.
   isolate->set_active_function_info_listener(NULL);
   script->set_source(*original_source);
+  // Preparse data recorded for the new source does not match the old one.
+  script->set_preparse_data(isolate->heap()->undefined_value());
 
   if (rethrow_exception.is_null()) {
     return listener.GetResult();
@@ -1372,6 +1375,7 @@ void LiveEdit::PatchFunctionPositions(Handle<JSArray> shared_info_array,
 static Handle<Script> CreateScriptCopy(Handle<Script> original) {
   Isolate* isolate = original->GetIsolate();
 
+  Script::EnsureSource(original);
   Handle<String> original_source(String::cast(original->source()));
   Handle<Script> copy = isolate->factory()->NewScript(original_source);
 
@@ -1408,8 +1412,10 @@ Handle<Object> LiveEdit::ChangeScriptSource(Handle<Script> original_script,
 
   original_script->set_source(*new_source);
 
-  // Drop line ends so that they will be recalculated.
+  // Drop line ends so that they will be recalculated, and preparse data that
+  // refers to positions in the old source.
   original_script->set_line_ends(isolate->heap()->undefined_value());
+  original_script->set_preparse_data(isolate->heap()->undefined_value());
 
   return old_script_object;
 }
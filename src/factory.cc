@@ -847,6 +847,7 @@ Handle<Script> Factory::NewScript(Handle<String> source) {
   script->set_eval_from_instructions_offset(Smi::FromInt(0));
   script->set_shared_function_infos(Smi::FromInt(0));
   script->set_flags(Smi::FromInt(0));
+  script->set_preparse_data(heap->undefined_value());
 
   return script;
 }
@@ -2453,6 +2454,11 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpMaxRegisterCountIndex, Smi::FromInt(0));
   store->set(JSRegExp::kIrregexpCaptureCountIndex,
              Smi::FromInt(capture_count));
+  store->set(JSRegExp::kIrregexpLatin1BytecodeIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpUC16BytecodeIndex, uninitialized);
+  int ticks = FLAG_regexp_tier_up ? Max(0, FLAG_regexp_tier_up_ticks)
+                                  : JSRegExp::kTieredUpValue;
+  store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::FromInt(ticks));
   regexp->set_data(*store);
 }
 
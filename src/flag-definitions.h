@@ -281,6 +281,10 @@ DEFINE_BOOL(string_slices, true, "use string slices")
 // Flags for Ignition.
 DEFINE_BOOL(ignition, false, "use ignition interpreter")
 DEFINE_STRING(ignition_filter, "~~", "filter for ignition interpreter")
+DEFINE_BOOL(trace_ignition, false,
+            "trace functions the ignition interpreter cannot run yet")
+DEFINE_BOOL(print_bytecode, false,
+            "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(trace_ignition_codegen, false,
             "trace the codegen of ignition interpreter bytecode handlers")
 
@@ -419,6 +423,9 @@ DEFINE_BOOL(turbo_stats, false, "print TurboFan statistics")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(turbo_types, true, "use typed lowering in TurboFan")
 DEFINE_BOOL(turbo_type_feedback, false, "use type feedback in TurboFan")
+DEFINE_BOOL(turbo_from_bytecode, false,
+            "optimize interpreted functions from their bytecode")
+DEFINE_IMPLICATION(turbo_from_bytecode, ignition)
 DEFINE_BOOL(turbo_allocate, false, "enable inline allocations in TurboFan")
 DEFINE_BOOL(turbo_source_positions, false,
             "track source code positions when building TurboFan IR")
@@ -598,6 +605,15 @@ DEFINE_BOOL(experimental_new_space_growth_heuristic, false,
 DEFINE_INT(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_INT(initial_old_space_size, 0, "initial old space size (in Mbytes)")
 DEFINE_INT(max_executable_size, 0, "max size of executable memory (in Mbytes)")
+DEFINE_INT(descriptor_lookup_cache_size, 64,
+           "number of entries in the descriptor lookup cache (rounded up to "
+           "a power of 2)")
+DEFINE_INT(descriptor_lookup_cache_associativity, 1,
+           "number of entries per set in the descriptor lookup cache "
+           "(rounded up to a power of 2)")
+DEFINE_INT(number_string_cache_size, 0,
+           "number of entries in the full-size number string cache (rounded "
+           "up to a power of 2, 0 to derive it from the semi-space size)")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
 DEFINE_INT(gc_interval, -1, "garbage collect after <n> allocations")
 DEFINE_INT(retain_maps_for_n_gc, 2,
@@ -652,6 +668,9 @@ DEFINE_BOOL(track_gc_object_stats, false,
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
+DEFINE_BOOL(trace_gc_map_stats, false,
+            "trace map, descriptor and transition memory per constructor "
+            "after each mark-compact")
 DEFINE_BOOL(track_detached_contexts, true,
             "track native contexts that are expected to be garbage collected")
 DEFINE_BOOL(trace_detached_contexts, false,
@@ -711,6 +730,9 @@ DEFINE_BOOL(eliminate_prototype_chain_checks, true,
             "Collapse prototype chain checks into single-cell checks")
 DEFINE_IMPLICATION(eliminate_prototype_chain_checks, track_prototype_users)
 DEFINE_BOOL(use_verbose_printer, true, "allows verbose printing")
+DEFINE_BOOL(in_place_elements_widening, true,
+            "widen smi backing stores to double backing stores in place "
+            "where the element sizes match (64-bit only)")
 #if TRACE_MAPS
 DEFINE_BOOL(trace_maps, false, "trace map creation")
 #endif
@@ -718,6 +740,13 @@ DEFINE_BOOL(trace_maps, false, "trace map creation")
 // parser.cc
 DEFINE_BOOL(allow_natives_syntax, false, "allow natives syntax")
 DEFINE_BOOL(trace_parse, false, "trace parsing and preparsing")
+DEFINE_BOOL(parse_streamed_functions_eagerly, false,
+            "fully parse and eagerly compile top-level functions of scripts "
+            "streamed to a background thread")
+DEFINE_BOOL(reuse_preparse_data, true,
+            "keep preparse data of inner functions for lazy compilation")
+DEFINE_BOOL(trace_discard_script_sources, false,
+            "trace discarding the source of compiled scripts")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
 DEFINE_BOOL(trace_sim, false, "Trace simulator execution")
@@ -765,6 +794,12 @@ DEFINE_BOOL(serialization_statistics, false,
 
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_BOOL(regexp_tier_up, false,
+            "run new regexps in the bytecode interpreter and compile them to "
+            "native code once they are hot")
+DEFINE_INT(regexp_tier_up_ticks, 1,
+           "number of executions in the regexp interpreter before tier-up")
+DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tier-up")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -32,6 +32,11 @@ function InnerArrayIncludes(searchElement, fromIndex, array, length) {
     }
   }
 
+  if (IS_ARRAY(array)) {
+    var result = %FastArrayIncludes(array, searchElement, k, length);
+    if (!IS_UNDEFINED(result)) return result;
+  }
+
   while (k < length) {
     var elementK = array[k];
     if ($sameValueZero(searchElement, elementK)) {
@@ -178,6 +178,10 @@ function InnerArrayFill(value, start, end, array, length) {
     throw MakeTypeError(kArrayFunctionsOnFrozen);
   }
 
+  if (IS_ARRAY(array) && !IS_UNDEFINED(%FastArrayFill(array, value, i, end))) {
+    return array;
+  }
+
   for (; i < end; i++)
     array[i] = value;
   return array;
@@ -635,9 +635,12 @@ void ExternalStringTable::ShrinkNewStrings(int position) {
 
 int DescriptorLookupCache::Lookup(Map* source, Name* name) {
   if (!name->IsUniqueName()) return kAbsent;
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  if ((key.source == source) && (key.name == name)) return results_[index];
+  Entry* set = &entries_[Hash(source, name)];
+  for (int i = 0; i < associativity_; i++) {
+    if ((set[i].source == source) && (set[i].name == name)) {
+      return set[i].result;
+    }
+  }
   return kAbsent;
 }
 
@@ -645,11 +648,14 @@ int DescriptorLookupCache::Lookup(Map* source, Name* name) {
 void DescriptorLookupCache::Update(Map* source, Name* name, int result) {
   DCHECK(result != kAbsent);
   if (name->IsUniqueName()) {
-    int index = Hash(source, name);
-    Key& key = keys_[index];
-    key.source = source;
-    key.name = name;
-    results_[index] = result;
+    DCHECK(!source->GetHeap()->InNewSpace(name));
+    Entry* set = &entries_[Hash(source, name)];
+    // Insert at the front of the set and evict the least recently inserted
+    // entry from the back.
+    for (int i = associativity_ - 1; i > 0; i--) set[i] = set[i - 1];
+    set[0].source = source;
+    set[0].name = name;
+    set[0].result = result;
   }
 }
 
@@ -1605,8 +1605,8 @@ void Heap::Scavenge() {
   // Implements Cheney's copying algorithm
   LOG(isolate_, ResourceEvent("scavenge", "begin"));
 
-  // Clear descriptor cache.
-  isolate_->descriptor_lookup_cache()->Clear();
+  // The descriptor lookup cache only refers to maps and unique names, which
+  // are not moved by a scavenge, so it is kept.
 
   // Used for updating survived_since_last_expansion_ at function end.
   intptr_t survived_watermark = PromotedSpaceSizeOfObjects();
@@ -3548,12 +3548,18 @@ void RegExpResultsCache::Clear(FixedArray* cache) {
 
 
 int Heap::FullSizeNumberStringCacheLength() {
-  // Compute the size of the number string cache based on the max newspace size.
-  // The number string cache has a minimum size based on twice the initial cache
-  // size to ensure that it is bigger after being made 'full size'.
-  int number_string_cache_size = max_semi_space_size_ / 512;
-  number_string_cache_size = Max(kInitialNumberStringCacheSize * 2,
-                                 Min(0x4000, number_string_cache_size));
+  // Compute the size of the number string cache based on the max newspace size
+  // unless it is given explicitly. The number string cache has a minimum size
+  // based on twice the initial cache size to ensure that it is bigger after
+  // being made 'full size'.
+  int number_string_cache_size = Min(0x4000, max_semi_space_size_ / 512);
+  if (FLAG_number_string_cache_size > 0) {
+    number_string_cache_size =
+        static_cast<int>(base::bits::RoundUpToPowerOfTwo32(
+            Min(FLAG_number_string_cache_size, kMaxNumberStringCacheSize)));
+  }
+  number_string_cache_size =
+      Max(kInitialNumberStringCacheSize * 2, number_string_cache_size);
   // There is a string and a number per entry so the length is twice the number
   // of entries.
   return number_string_cache_size * 2;
@@ -6619,8 +6625,30 @@ void KeyedLookupCache::Clear() {
 }
 
 
+DescriptorLookupCache::DescriptorLookupCache() {
+  int length = Max(1, FLAG_descriptor_lookup_cache_size);
+  int associativity = Max(1, FLAG_descriptor_lookup_cache_associativity);
+  length_ = static_cast<int>(base::bits::RoundUpToPowerOfTwo32(length));
+  associativity_ = Min(
+      static_cast<int>(base::bits::RoundUpToPowerOfTwo32(associativity)),
+      length_);
+  set_mask_ = static_cast<uint32_t>(length_ / associativity_ - 1);
+  entries_ = NewArray<Entry>(length_);
+  for (int i = 0; i < length_; i++) {
+    entries_[i].source = NULL;
+    entries_[i].name = NULL;
+    entries_[i].result = kAbsent;
+  }
+}
+
+
+DescriptorLookupCache::~DescriptorLookupCache() { DeleteArray(entries_); }
+
+
 void DescriptorLookupCache::Clear() {
-  for (int index = 0; index < kLength; index++) keys_[index].source = NULL;
+  for (int index = 0; index < length_; index++) {
+    entries_[index].source = NULL;
+  }
 }
 
 
@@ -1698,6 +1698,7 @@ class Heap {
   static const int kInitialStringTableSize = 2048;
   static const int kInitialEvalCacheSize = 64;
   static const int kInitialNumberStringCacheSize = 256;
+  static const int kMaxNumberStringCacheSize = 1 << 20;
 
  private:
   Heap();
@@ -2624,7 +2625,10 @@ class KeyedLookupCache {
 // Cache for mapping (map, property name) into descriptor index.
 // The cache contains both positive and negative results.
 // Descriptor index equals kNotFound means the property is absent.
-// Cleared at startup and prior to any gc.
+// The cache is set associative; its size and associativity are taken from
+// --descriptor_lookup_cache_size and --descriptor_lookup_cache_associativity.
+// Cleared at startup and prior to any mark-compact. Maps and unique names
+// are never allocated in new space, so entries survive scavenges.
 class DescriptorLookupCache {
  public:
   // Lookup descriptor index for (map, name).
@@ -2637,18 +2641,17 @@ class DescriptorLookupCache {
   // Clear the cache.
   void Clear();
 
+  int length() const { return length_; }
+  int associativity() const { return associativity_; }
+
   static const int kAbsent = -2;
 
  private:
-  DescriptorLookupCache() {
-    for (int i = 0; i < kLength; ++i) {
-      keys_[i].source = NULL;
-      keys_[i].name = NULL;
-      results_[i] = kAbsent;
-    }
-  }
+  DescriptorLookupCache();
+  ~DescriptorLookupCache();
 
-  static int Hash(Object* source, Name* name) {
+  // Returns the index of the first entry of the set for (source, name).
+  int Hash(Object* source, Name* name) {
     // Uses only lower 32 bits if pointers are larger.
     uint32_t source_hash =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(source)) >>
@@ -2656,17 +2659,19 @@ class DescriptorLookupCache {
     uint32_t name_hash =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name)) >>
         kPointerSizeLog2;
-    return (source_hash ^ name_hash) % kLength;
+    return ((source_hash ^ name_hash) & set_mask_) * associativity_;
   }
 
-  static const int kLength = 64;
-  struct Key {
+  struct Entry {
     Map* source;
     Name* name;
+    int result;
   };
 
-  Key keys_[kLength];
-  int results_[kLength];
+  Entry* entries_;
+  int length_;
+  int associativity_;
+  uint32_t set_mask_;
 
   friend class Isolate;
   DISALLOW_COPY_AND_ASSIGN(DescriptorLookupCache);
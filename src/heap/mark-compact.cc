@@ -2380,6 +2380,120 @@ void MarkCompactCollector::ClearNonLiveReferences() {
       table->ElementRemoved();
     }
   }
+
+  if (FLAG_trace_gc_map_stats) TraceMapStatsPerConstructor();
+}
+
+
+namespace {
+
+struct MapStats {
+  Object* constructor;
+  int maps;
+  intptr_t map_bytes;
+  intptr_t descriptor_bytes;
+  intptr_t transition_bytes;
+  intptr_t layout_bytes;
+
+  intptr_t total_bytes() const {
+    return map_bytes + descriptor_bytes + transition_bytes + layout_bytes;
+  }
+};
+
+
+int CompareMapStatsBySize(const MapStats* a, const MapStats* b) {
+  intptr_t a_bytes = a->total_bytes();
+  intptr_t b_bytes = b->total_bytes();
+  if (a_bytes == b_bytes) return 0;
+  return a_bytes > b_bytes ? -1 : 1;
+}
+
+
+void PrintMapStats(Isolate* isolate, const char* name, const MapStats& s) {
+  PrintIsolate(isolate,
+               "  %-32s maps: %6d, map: %7" V8_PTR_PREFIX
+               "d KB, descriptors: %7" V8_PTR_PREFIX
+               "d KB, transitions: %7" V8_PTR_PREFIX
+               "d KB, layout: %5" V8_PTR_PREFIX "d KB\n",
+               name, s.maps, s.map_bytes / KB, s.descriptor_bytes / KB,
+               s.transition_bytes / KB, s.layout_bytes / KB);
+}
+
+}  // namespace
+
+
+void MarkCompactCollector::TraceMapStatsPerConstructor() {
+  static const int kMaxConstructorsToPrint = 20;
+  DisallowHeapAllocation no_allocation;
+  HashMap constructor_index(HashMap::PointersMatch);
+  List<MapStats> stats;
+
+  HeapObjectIterator map_iterator(heap()->map_space());
+  for (HeapObject* obj = map_iterator.Next(); obj != NULL;
+       obj = map_iterator.Next()) {
+    Map* map = Map::cast(obj);
+    if (!Marking::IsBlackOrGrey(Marking::MarkBitFrom(map))) continue;
+
+    Object* constructor = map->GetConstructor();
+    // Group functions by their SharedFunctionInfo so that closures created
+    // from the same function literal are reported together.
+    if (constructor->IsJSFunction()) {
+      constructor = JSFunction::cast(constructor)->shared();
+    }
+    HashMap::Entry* entry = constructor_index.LookupOrInsert(
+        constructor, static_cast<uint32_t>(
+                         reinterpret_cast<uintptr_t>(constructor) >> 3));
+    if (entry->value == NULL) {
+      MapStats empty = {constructor, 0, 0, 0, 0, 0};
+      stats.Add(empty);
+      entry->value = reinterpret_cast<void*>(stats.length());
+    }
+    MapStats& s = stats[static_cast<int>(
+                            reinterpret_cast<intptr_t>(entry->value)) -
+                        1];
+
+    s.maps++;
+    s.map_bytes += map->Size();
+    if (map->owns_descriptors()) {
+      DescriptorArray* descriptors = map->instance_descriptors();
+      if (descriptors->length() > 0) {
+        s.descriptor_bytes += descriptors->Size();
+        if (descriptors->HasEnumCache()) {
+          s.descriptor_bytes += descriptors->GetEnumCache()->Size();
+        }
+      }
+      if (FLAG_unbox_double_fields) {
+        LayoutDescriptor* layout = map->layout_descriptor_gc_safe();
+        if (!layout->IsFastPointerLayout()) s.layout_bytes += layout->Size();
+      }
+    }
+    Object* transitions = map->raw_transitions();
+    if (TransitionArray::IsFullTransitionArray(transitions)) {
+      TransitionArray* t = TransitionArray::cast(transitions);
+      s.transition_bytes += t->Size();
+      if (t->HasPrototypeTransitions()) {
+        s.transition_bytes += t->GetPrototypeTransitions()->Size();
+      }
+    } else if (transitions->IsWeakCell()) {
+      s.transition_bytes += WeakCell::kSize;
+    }
+  }
+
+  stats.Sort(&CompareMapStatsBySize);
+  PrintIsolate(isolate(), "Map memory per constructor (%d constructors)\n",
+               stats.length());
+  for (int i = 0; i < stats.length() && i < kMaxConstructorsToPrint; i++) {
+    const MapStats& s = stats[i];
+    if (s.constructor->IsSharedFunctionInfo()) {
+      base::SmartArrayPointer<char> name =
+          SharedFunctionInfo::cast(s.constructor)
+              ->DebugName()
+              ->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL);
+      PrintMapStats(isolate(), name.get(), s);
+    } else {
+      PrintMapStats(isolate(), "<no constructor>", s);
+    }
+  }
 }
 
 
@@ -2413,6 +2527,27 @@ void MarkCompactCollector::ClearNonLivePrototypeTransitions(Map* map) {
   for (int i = new_number_of_transitions; i < number_of_transitions; i++) {
     prototype_transitions->set_undefined(header + i);
   }
+
+  TrimPrototypeTransitions(prototype_transitions, new_number_of_transitions);
+}
+
+
+void MarkCompactCollector::TrimPrototypeTransitions(
+    FixedArray* prototype_transitions, int number_of_transitions) {
+  // The shared empty fixed array is used when there is no cache at all, and
+  // caches of dead maps are reclaimed by the sweeper anyway.
+  if (prototype_transitions->length() == 0) return;
+  if (!IsMarked(prototype_transitions)) return;
+  const int header = TransitionArray::kProtoTransitionHeaderSize;
+  int capacity = prototype_transitions->length() - header;
+  // Only shrink caches that are mostly dead so that a map whose prototype
+  // transitions keep dying and being recreated does not regrow every GC.
+  // TransitionArray::PutPrototypeTransition() derives the capacity from the
+  // array length and grows it again on demand.
+  if (capacity <= 2 * number_of_transitions) return;
+  int to_trim = capacity - number_of_transitions;
+  heap_->RightTrimFixedArray<Heap::SEQUENTIAL_TO_SWEEPER>(prototype_transitions,
+                                                          to_trim);
 }
 
 
@@ -840,6 +840,12 @@ class MarkCompactCollector {
   void TrimDescriptorArray(Map* map, DescriptorArray* descriptors,
                            int number_of_own_descriptors);
   void TrimEnumCache(Map* map, DescriptorArray* descriptors);
+  void TrimPrototypeTransitions(FixedArray* prototype_transitions,
+                                int number_of_transitions);
+
+  // Prints the memory held by live maps and the descriptor, transition and
+  // layout descriptor arrays they own, grouped by constructor.
+  void TraceMapStatsPerConstructor();
 
   // Mark all values associated with reachable keys in weak collections
   // encountered so far.  This might push new object or even new weak maps onto
@@ -0,0 +1,330 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/interpreter/bytecode-generator.h"
+
+#include "src/compiler.h"
+#include "src/scopes.h"
+#include "src/token.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+BytecodeGenerator::BytecodeGenerator(Isolate* isolate, Zone* zone)
+    : builder_(isolate), scope_(nullptr), bailout_reason_(nullptr) {
+  InitializeAstVisitor(isolate, zone);
+}
+
+
+Handle<BytecodeArray> BytecodeGenerator::MakeBytecode(CompilationInfo* info) {
+  scope_ = info->scope();
+
+  // The interpreter entry trampoline neither allocates a function context
+  // nor copies arguments, and the exit trampoline only drops the receiver.
+  if (scope()->num_parameters() > 0) {
+    Bailout("function has formal parameters");
+  } else if (scope()->num_heap_slots() > 0) {
+    Bailout("function needs a context");
+  } else if (scope()->arguments() != nullptr) {
+    Bailout("function uses arguments");
+  } else if (scope()->num_stack_slots() >= Register::kMaxRegisterIndex) {
+    Bailout("too many stack locals");
+  }
+  if (HasStackOverflow()) return Handle<BytecodeArray>();
+
+  // BytecodeArray does not allow a zero size register file.
+  builder()->set_locals_count(Max(1, scope()->num_stack_slots()));
+
+  VisitDeclarations(scope()->declarations());
+  VisitStatements(info->function()->body());
+  if (HasStackOverflow()) return Handle<BytecodeArray>();
+
+  // Falling off the end of the function returns undefined.
+  builder()->LoadUndefined().Return();
+  return builder()->ToBytecodeArray();
+}
+
+
+void BytecodeGenerator::Bailout(const char* reason) {
+  if (bailout_reason_ == nullptr) bailout_reason_ = reason;
+  SetStackOverflow();
+}
+
+
+bool BytecodeGenerator::StackLocalRegisterIndex(Variable* variable,
+                                                int* index) {
+  // Only 'var' bindings live in registers which the trampoline initialized
+  // to undefined; everything else needs hole checks or context access.
+  if (!variable->IsStackLocal() ||
+      (variable->mode() != VAR && variable->mode() != TEMPORARY)) {
+    Bailout("unsupported variable");
+    return false;
+  }
+  *index = variable->index();
+  return true;
+}
+
+
+void BytecodeGenerator::VisitVariableDeclaration(VariableDeclaration* decl) {
+  Variable* variable = decl->proxy()->var();
+  // Unused locals of a function scope are never allocated.
+  if (variable->IsUnallocated()) return;
+  int index;
+  StackLocalRegisterIndex(variable, &index);
+}
+
+
+void BytecodeGenerator::VisitFunctionDeclaration(FunctionDeclaration* decl) {
+  Bailout("function declaration");
+}
+
+
+void BytecodeGenerator::VisitImportDeclaration(ImportDeclaration* decl) {
+  UNREACHABLE();
+}
+
+
+void BytecodeGenerator::VisitExportDeclaration(ExportDeclaration* decl) {
+  UNREACHABLE();
+}
+
+
+void BytecodeGenerator::VisitExpressionStatement(ExpressionStatement* stmt) {
+  Visit(stmt->expression());
+}
+
+
+void BytecodeGenerator::VisitEmptyStatement(EmptyStatement* stmt) {}
+
+
+void BytecodeGenerator::VisitBlock(Block* block) {
+  if (block->scope() != nullptr && block->scope()->ContextLocalCount() > 0) {
+    Bailout("block context");
+    return;
+  }
+  VisitStatements(block->statements());
+}
+
+
+void BytecodeGenerator::VisitIfStatement(IfStatement* stmt) {
+  Bailout("if statement");
+}
+
+
+void BytecodeGenerator::VisitContinueStatement(ContinueStatement* stmt) {
+  Bailout("continue statement");
+}
+
+
+void BytecodeGenerator::VisitBreakStatement(BreakStatement* stmt) {
+  Bailout("break statement");
+}
+
+
+void BytecodeGenerator::VisitReturnStatement(ReturnStatement* stmt) {
+  Visit(stmt->expression());
+  builder()->Return();
+}
+
+
+void BytecodeGenerator::VisitWithStatement(WithStatement* stmt) {
+  Bailout("with statement");
+}
+
+
+void BytecodeGenerator::VisitSwitchStatement(SwitchStatement* stmt) {
+  Bailout("switch statement");
+}
+
+
+void BytecodeGenerator::VisitCaseClause(CaseClause* clause) { UNREACHABLE(); }
+
+
+void BytecodeGenerator::VisitDoWhileStatement(DoWhileStatement* stmt) {
+  Bailout("do-while statement");
+}
+
+
+void BytecodeGenerator::VisitWhileStatement(WhileStatement* stmt) {
+  Bailout("while statement");
+}
+
+
+void BytecodeGenerator::VisitForStatement(ForStatement* stmt) {
+  Bailout("for statement");
+}
+
+
+void BytecodeGenerator::VisitForInStatement(ForInStatement* stmt) {
+  Bailout("for-in statement");
+}
+
+
+void BytecodeGenerator::VisitForOfStatement(ForOfStatement* stmt) {
+  Bailout("for-of statement");
+}
+
+
+void BytecodeGenerator::VisitTryCatchStatement(TryCatchStatement* stmt) {
+  Bailout("try-catch statement");
+}
+
+
+void BytecodeGenerator::VisitTryFinallyStatement(TryFinallyStatement* stmt) {
+  Bailout("try-finally statement");
+}
+
+
+void BytecodeGenerator::VisitDebuggerStatement(DebuggerStatement* stmt) {
+  Bailout("debugger statement");
+}
+
+
+void BytecodeGenerator::VisitFunctionLiteral(FunctionLiteral* expr) {
+  Bailout("function literal");
+}
+
+
+void BytecodeGenerator::VisitClassLiteral(ClassLiteral* expr) {
+  Bailout("class literal");
+}
+
+
+void BytecodeGenerator::VisitNativeFunctionLiteral(
+    NativeFunctionLiteral* expr) {
+  Bailout("native function literal");
+}
+
+
+void BytecodeGenerator::VisitConditional(Conditional* expr) {
+  Bailout("conditional");
+}
+
+
+void BytecodeGenerator::VisitLiteral(Literal* expr) {
+  Handle<Object> value = expr->value();
+  if (value->IsSmi()) {
+    int raw_smi = Smi::cast(*value)->value();
+    if (raw_smi < kMinInt8 || raw_smi > kMaxInt8) {
+      Bailout("smi literal out of range");
+      return;
+    }
+    builder()->LoadLiteral(Smi::cast(*value));
+  } else if (value->IsUndefined()) {
+    builder()->LoadUndefined();
+  } else if (value->IsNull()) {
+    builder()->LoadNull();
+  } else if (value->IsTheHole()) {
+    builder()->LoadTheHole();
+  } else if (value->IsTrue()) {
+    builder()->LoadTrue();
+  } else if (value->IsFalse()) {
+    builder()->LoadFalse();
+  } else {
+    Bailout("heap object literal");
+  }
+}
+
+
+void BytecodeGenerator::VisitRegExpLiteral(RegExpLiteral* expr) {
+  Bailout("regexp literal");
+}
+
+
+void BytecodeGenerator::VisitObjectLiteral(ObjectLiteral* expr) {
+  Bailout("object literal");
+}
+
+
+void BytecodeGenerator::VisitArrayLiteral(ArrayLiteral* expr) {
+  Bailout("array literal");
+}
+
+
+void BytecodeGenerator::VisitVariableProxy(VariableProxy* proxy) {
+  int index;
+  if (!StackLocalRegisterIndex(proxy->var(), &index)) return;
+  builder()->LoadAccumulatorWithRegister(Register(index));
+}
+
+
+void BytecodeGenerator::VisitAssignment(Assignment* expr) {
+  VariableProxy* proxy = expr->target()->AsVariableProxy();
+  if (expr->op() != Token::ASSIGN || proxy == nullptr) {
+    Bailout("unsupported assignment");
+    return;
+  }
+  int index;
+  if (!StackLocalRegisterIndex(proxy->var(), &index)) return;
+  Visit(expr->value());
+  // The value of the assignment stays in the accumulator.
+  builder()->StoreAccumulatorInRegister(Register(index));
+}
+
+
+void BytecodeGenerator::VisitYield(Yield* expr) { Bailout("yield"); }
+
+
+void BytecodeGenerator::VisitThrow(Throw* expr) { Bailout("throw"); }
+
+
+void BytecodeGenerator::VisitProperty(Property* expr) {
+  Bailout("property access");
+}
+
+
+void BytecodeGenerator::VisitCall(Call* expr) { Bailout("call"); }
+
+
+void BytecodeGenerator::VisitCallNew(CallNew* expr) { Bailout("call new"); }
+
+
+void BytecodeGenerator::VisitCallRuntime(CallRuntime* expr) {
+  Bailout("runtime call");
+}
+
+
+void BytecodeGenerator::VisitUnaryOperation(UnaryOperation* expr) {
+  Bailout("unary operation");
+}
+
+
+void BytecodeGenerator::VisitCountOperation(CountOperation* expr) {
+  Bailout("count operation");
+}
+
+
+void BytecodeGenerator::VisitBinaryOperation(BinaryOperation* expr) {
+  // There are no handlers for binary operations yet.
+  Bailout("binary operation");
+}
+
+
+void BytecodeGenerator::VisitCompareOperation(CompareOperation* expr) {
+  Bailout("compare operation");
+}
+
+
+void BytecodeGenerator::VisitSpread(Spread* expr) { UNREACHABLE(); }
+
+
+void BytecodeGenerator::VisitThisFunction(ThisFunction* expr) {
+  Bailout("this function");
+}
+
+
+void BytecodeGenerator::VisitSuperPropertyReference(
+    SuperPropertyReference* expr) {
+  Bailout("super property reference");
+}
+
+
+void BytecodeGenerator::VisitSuperCallReference(SuperCallReference* expr) {
+  Bailout("super call reference");
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,64 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INTERPRETER_BYTECODE_GENERATOR_H_
+#define V8_INTERPRETER_BYTECODE_GENERATOR_H_
+
+#include "src/ast.h"
+#include "src/interpreter/bytecode-array-builder.h"
+#include "src/interpreter/bytecodes.h"
+
+namespace v8 {
+namespace internal {
+
+class CompilationInfo;
+
+namespace interpreter {
+
+// Walks the AST of a function and emits bytecode for it. Functions using
+// constructs which have no bytecode sequence yet are rejected, in which case
+// MakeBytecode returns an empty handle and the caller is expected to fall
+// back to full-codegen.
+class BytecodeGenerator : public AstVisitor {
+ public:
+  BytecodeGenerator(Isolate* isolate, Zone* zone);
+  virtual ~BytecodeGenerator() {}
+
+  Handle<BytecodeArray> MakeBytecode(CompilationInfo* info);
+
+#define DECLARE_VISIT(type) void Visit##type(type* node) override;
+  AST_NODE_LIST(DECLARE_VISIT)
+#undef DECLARE_VISIT
+
+  // A stack overflow while visiting the AST stops generation without a
+  // bailout reason.
+  const char* bailout_reason() const {
+    return bailout_reason_ != nullptr ? bailout_reason_ : "stack overflow";
+  }
+
+ private:
+  DEFINE_AST_VISITOR_SUBCLASS_MEMBERS();
+
+  // Stops generation; the function cannot be run by the interpreter.
+  void Bailout(const char* reason);
+
+  // Returns the register holding |variable| if it is a stack local which the
+  // interpreter can access, otherwise bails out.
+  bool StackLocalRegisterIndex(Variable* variable, int* index);
+
+  BytecodeArrayBuilder* builder() { return &builder_; }
+  Scope* scope() const { return scope_; }
+
+  BytecodeArrayBuilder builder_;
+  Scope* scope_;
+  const char* bailout_reason_;
+
+  DISALLOW_COPY_AND_ASSIGN(BytecodeGenerator);
+};
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INTERPRETER_BYTECODE_GENERATOR_H_
@@ -7,6 +7,7 @@
 #include "src/compiler.h"
 #include "src/compiler/interpreter-assembler.h"
 #include "src/factory.h"
+#include "src/interpreter/bytecode-generator.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/zone.h"
 
@@ -56,6 +57,35 @@ void Interpreter::Initialize() {
 }
 
 
+// static
+bool Interpreter::MakeBytecode(CompilationInfo* info) {
+  Handle<SharedFunctionInfo> shared_info = info->shared_info();
+  if (!shared_info->function_data()->IsUndefined()) return false;
+
+  BytecodeGenerator generator(info->isolate(), info->zone());
+  Handle<BytecodeArray> bytecodes = generator.MakeBytecode(info);
+  if (bytecodes.is_null()) {
+    if (FLAG_trace_ignition) {
+      PrintF("[ignition: not interpreting ");
+      shared_info->ShortPrint();
+      PrintF(", %s]\n", generator.bailout_reason());
+    }
+    return false;
+  }
+
+  if (FLAG_print_bytecode) {
+    OFStream os(stdout);
+    bytecodes->Disassemble(os);
+    os << std::flush;
+  }
+
+  shared_info->set_function_data(*bytecodes);
+  info->SetCode(info->isolate()->builtins()->InterpreterEntryTrampoline());
+  info->EnsureFeedbackVector();
+  return true;
+}
+
+
 bool Interpreter::IsInterpreterTableInitialized(
     Handle<FixedArray> handler_table) {
   DCHECK(handler_table->length() == static_cast<int>(Bytecode::kLast) + 1);
@@ -67,7 +97,8 @@ bool Interpreter::IsInterpreterTableInitialized(
 //
 // Load literal '0' into the accumulator.
 void Interpreter::DoLdaZero(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Node* zero_value = __ NumberConstant(0.0);
+  __ SetAccumulator(zero_value);
   __ Dispatch();
 }
 
@@ -76,7 +107,9 @@ void Interpreter::DoLdaZero(compiler::InterpreterAssembler* assembler) {
 //
 // Load an 8-bit integer literal into the accumulator as a Smi.
 void Interpreter::DoLdaSmi8(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement 8-bit integer to SMI promotion.
+  Node* raw_int = __ BytecodeOperandImm8(0);
+  Node* smi_int = __ SmiTag(raw_int);
+  __ SetAccumulator(smi_int);
   __ Dispatch();
 }
 
@@ -85,7 +118,9 @@ void Interpreter::DoLdaSmi8(compiler::InterpreterAssembler* assembler) {
 //
 // Load Undefined into the accumulator.
 void Interpreter::DoLdaUndefined(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Unique<HeapObject> undefined_value = Unique<HeapObject>::CreateImmovable(
+      isolate_->factory()->undefined_value());
+  __ SetAccumulator(__ HeapConstant(undefined_value));
   __ Dispatch();
 }
 
@@ -94,7 +129,9 @@ void Interpreter::DoLdaUndefined(compiler::InterpreterAssembler* assembler) {
 //
 // Load Null into the accumulator.
 void Interpreter::DoLdaNull(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Unique<HeapObject> null_value = Unique<HeapObject>::CreateImmovable(
+      isolate_->factory()->null_value());
+  __ SetAccumulator(__ HeapConstant(null_value));
   __ Dispatch();
 }
 
@@ -103,7 +140,9 @@ void Interpreter::DoLdaNull(compiler::InterpreterAssembler* assembler) {
 //
 // Load TheHole into the accumulator.
 void Interpreter::DoLdaTheHole(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Unique<HeapObject> the_hole_value = Unique<HeapObject>::CreateImmovable(
+      isolate_->factory()->the_hole_value());
+  __ SetAccumulator(__ HeapConstant(the_hole_value));
   __ Dispatch();
 }
 
@@ -112,7 +151,9 @@ void Interpreter::DoLdaTheHole(compiler::InterpreterAssembler* assembler) {
 //
 // Load True into the accumulator.
 void Interpreter::DoLdaTrue(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Unique<HeapObject> true_value = Unique<HeapObject>::CreateImmovable(
+      isolate_->factory()->true_value());
+  __ SetAccumulator(__ HeapConstant(true_value));
   __ Dispatch();
 }
 
@@ -121,7 +162,9 @@ void Interpreter::DoLdaTrue(compiler::InterpreterAssembler* assembler) {
 //
 // Load False into the accumulator.
 void Interpreter::DoLdaFalse(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Unique<HeapObject> false_value = Unique<HeapObject>::CreateImmovable(
+      isolate_->factory()->false_value());
+  __ SetAccumulator(__ HeapConstant(false_value));
   __ Dispatch();
 }
 
@@ -130,7 +173,8 @@ void Interpreter::DoLdaFalse(compiler::InterpreterAssembler* assembler) {
 //
 // Load accumulator with value from register <src>.
 void Interpreter::DoLdar(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Node* value = __ LoadRegister(__ BytecodeOperandReg(0));
+  __ SetAccumulator(value);
   __ Dispatch();
 }
 
@@ -139,7 +183,9 @@ void Interpreter::DoLdar(compiler::InterpreterAssembler* assembler) {
 //
 // Store accumulator to register <dst>.
 void Interpreter::DoStar(compiler::InterpreterAssembler* assembler) {
-  // TODO(rmcilroy) Implement.
+  Node* reg_index = __ BytecodeOperandReg(0);
+  Node* accumulator = __ GetAccumulator();
+  __ StoreRegister(accumulator, reg_index);
   __ Dispatch();
 }
 
@@ -182,7 +228,7 @@ void Interpreter::DoDiv(compiler::InterpreterAssembler* assembler) {
 
 // Return
 //
-// Return the value in register 0.
+// Return the value in the accumulator.
 void Interpreter::DoReturn(compiler::InterpreterAssembler* assembler) {
   __ Return();
 }
@@ -36,6 +36,11 @@ class Interpreter {
   // Initializes the interpreter.
   void Initialize();
 
+  // Generate bytecode for |info|. Returns false if the function uses
+  // constructs the interpreter does not support yet, in which case the caller
+  // should compile it with full-codegen instead.
+  static bool MakeBytecode(CompilationInfo* info);
+
  private:
 // Bytecode handler generator functions.
 #define DECLARE_BYTECODE_HANDLER_GENERATOR(Name, ...) \
@@ -2620,6 +2620,37 @@ void Isolate::ReportPromiseReject(Handle<JSObject> promise,
 }
 
 
+void Isolate::DiscardScriptSources() {
+  if (script_source_callback_ == NULL) return;
+  // The debugger relies on script sources for break points and live edit.
+  if (debug()->is_active()) return;
+
+  HandleScope scope(this);
+  List<Handle<Script> > scripts;
+  {
+    HeapIterator iterator(heap());
+    for (HeapObject* obj = iterator.next(); obj != NULL;
+         obj = iterator.next()) {
+      if (!obj->IsScript()) continue;
+      Script* script = Script::cast(obj);
+      if (script->CanDiscardSource()) scripts.Add(handle(script, this));
+    }
+  }
+
+  for (int i = 0; i < scripts.length(); i++) {
+    Handle<Script> script = scripts[i];
+    // Compute the line ends first, so that positions in stack traces and
+    // messages can be resolved without asking for the source.
+    Script::InitLineEnds(script);
+    script->set_source(heap()->undefined_value());
+    script->set_source_discarded(true);
+  }
+  if (FLAG_trace_discard_script_sources) {
+    PrintF("[discarded the source of %d scripts]\n", scripts.length());
+  }
+}
+
+
 void Isolate::EnqueueMicrotask(Handle<Object> microtask) {
   DCHECK(microtask->IsJSFunction() || microtask->IsCallHandlerInfo());
   Handle<FixedArray> queue(heap()->microtask_queue(), this);
@@ -386,7 +386,9 @@ typedef List<HeapObject*> DebugObjectCache;
   V(bool, fp_stubs_generated, false)                                           \
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                            \
   V(PromiseRejectCallback, promise_reject_callback, NULL)                      \
+  V(ScriptSourceCallback, script_source_callback, NULL)                        \
   V(const v8::StartupData*, snapshot_blob, NULL)                               \
+  V(intptr_t*, api_external_references, NULL)                                  \
   ISOLATE_INIT_SIMULATOR_LIST(V)
 
 #define THREAD_LOCAL_TOP_ACCESSOR(type, name)                        \
@@ -1095,6 +1097,10 @@ class Isolate {
   void ReportPromiseReject(Handle<JSObject> promise, Handle<Object> value,
                            v8::PromiseRejectEvent event);
 
+  // Drops the source of scripts which the embedder can supply again through
+  // the script source callback, see Script::EnsureSource.
+  void DiscardScriptSources();
+
   void EnqueueMicrotask(Handle<Object> microtask);
   void RunMicrotasks();
 
@@ -1399,7 +1405,8 @@ class Isolate {
   friend class v8::Isolate;
   friend class v8::Locker;
   friend class v8::Unlocker;
-  friend v8::StartupData v8::V8::CreateSnapshotDataBlob(const char*);
+  friend v8::StartupData v8::V8::CreateSnapshotDataBlob(
+      const char*, intptr_t*, v8::SnapshotInitializerCallback);
 
   DISALLOW_COPY_AND_ASSIGN(Isolate);
 };
@@ -16,7 +16,8 @@ namespace internal {
 enum ParseElementResult { kElementFound, kElementNotFound, kNullHandle };
 
 
-// A simple json parser.
+// A simple json parser. With seq_one_byte the source must be a sequential or
+// an external one-byte string, whose characters are read directly.
 template <bool seq_one_byte>
 class JsonParser BASE_EMBEDDED {
  public:
@@ -34,16 +35,29 @@ class JsonParser BASE_EMBEDDED {
         factory_(isolate_->factory()),
         object_constructor_(isolate_->native_context()->object_function(),
                             isolate_),
+        external_chars_(NULL),
         position_(-1) {
     source_ = String::Flatten(source_);
     pretenure_ = (source_length_ >= kPretenureTreshold) ? TENURED : NOT_TENURED;
 
     // Optimized fast case where we only have Latin1 characters.
     if (seq_one_byte) {
-      seq_source_ = Handle<SeqOneByteString>::cast(source_);
+      if (source_->IsExternalOneByteString()) {
+        external_chars_ = ExternalOneByteString::cast(*source_)->GetChars();
+      } else {
+        seq_source_ = Handle<SeqOneByteString>::cast(source_);
+      }
     }
   }
 
+  // Returns the characters of a one-byte source. A sequential source can be
+  // moved by the GC, so the result must not be held across allocations.
+  inline const uint8_t* OneByteChars() {
+    DCHECK(seq_one_byte);
+    if (external_chars_ != NULL) return external_chars_;
+    return seq_source_->GetChars();
+  }
+
   // Parse a string containing a single JSON value.
   MaybeHandle<Object> ParseJson();
 
@@ -52,7 +66,7 @@ class JsonParser BASE_EMBEDDED {
     if (position_ >= source_length_) {
       c0_ = kEndOfString;
     } else if (seq_one_byte) {
-      c0_ = seq_source_->SeqOneByteStringGet(position_);
+      c0_ = OneByteChars()[position_];
     } else {
       c0_ = source_->Get(position_);
     }
@@ -104,7 +118,7 @@ class JsonParser BASE_EMBEDDED {
       String::FlatContent content = expected->GetFlatContent();
       if (content.IsOneByte()) {
         DCHECK_EQ('"', c0_);
-        const uint8_t* input_chars = seq_source_->GetChars() + position_ + 1;
+        const uint8_t* input_chars = OneByteChars() + position_ + 1;
         const uint8_t* expected_chars = content.ToOneByteVector().start();
         for (int i = 0; i < length; i++) {
           uint8_t c0 = input_chars[i];
@@ -179,6 +193,8 @@ class JsonParser BASE_EMBEDDED {
 
   static const int kInitialSpecialStringLength = 32;
   static const int kPretenureTreshold = 100 * 1024;
+  // Integers with at most this many digits are below 2^53.
+  static const int kMaxExactIntegerDigits = 15;
 
 
  private:
@@ -196,6 +212,8 @@ class JsonParser BASE_EMBEDDED {
   Factory* factory_;
   Zone zone_;
   Handle<JSFunction> object_constructor_;
+  // Characters of an external one-byte source, which do not move.
+  const uint8_t* external_chars_;
   uc32 c0_;
   int position_;
 };
@@ -544,17 +562,24 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonNumber() {
     // a decimal point or exponent.
     if (IsDecimalDigit(c0_)) return ReportUnexpectedCharacter();
   } else {
-    int i = 0;
+    int64_t i = 0;
     int digits = 0;
     if (c0_ < '1' || c0_ > '9') return ReportUnexpectedCharacter();
     do {
-      i = i * 10 + c0_ - '0';
+      if (digits < kMaxExactIntegerDigits) i = i * 10 + c0_ - '0';
       digits++;
       Advance();
     } while (IsDecimalDigit(c0_));
-    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E' && digits < 10) {
+    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E' &&
+        digits <= kMaxExactIntegerDigits) {
+      // Integers that are exactly representable as doubles are converted
+      // without going through StringToDouble.
       SkipWhitespace();
-      return Handle<Smi>(Smi::FromInt((negative ? -i : i)), isolate());
+      if (negative) i = -i;
+      if (i >= Smi::kMinValue && i <= Smi::kMaxValue) {
+        return Handle<Smi>(Smi::FromInt(static_cast<int>(i)), isolate());
+      }
+      return factory()->NewNumber(static_cast<double>(i), pretenure_);
     }
   }
   if (c0_ == '.') {
@@ -575,7 +600,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonNumber() {
   int length = position_ - beg_pos;
   double number;
   if (seq_one_byte) {
-    Vector<const uint8_t> chars(seq_source_->GetChars() +  beg_pos, length);
+    Vector<const uint8_t> chars(OneByteChars() + beg_pos, length);
     number = StringToDouble(isolate()->unicode_cache(), chars,
                             NO_FLAGS,  // Hex, octal or trailing junk.
                             std::numeric_limits<double>::quiet_NaN());
@@ -767,14 +792,13 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
       }
       position++;
       if (position >= source_length_) return Handle<String>::null();
-      c0 = seq_source_->SeqOneByteStringGet(position);
+      c0 = OneByteChars()[position];
     } while (c0 != '"');
     int length = position - position_;
     uint32_t hash = (length <= String::kMaxHashCalcLength)
                         ? StringHasher::GetHashCore(running_hash)
                         : static_cast<uint32_t>(length);
-    Vector<const uint8_t> string_vector(
-        seq_source_->GetChars() + position_, length);
+    Vector<const uint8_t> string_vector(OneByteChars() + position_, length);
     StringTable* string_table = isolate()->heap()->string_table();
     uint32_t capacity = string_table->Capacity();
     uint32_t entry = StringTable::FirstProbe(hash, capacity);
@@ -784,8 +808,12 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
       Object* element = string_table->KeyAt(entry);
       if (element == isolate()->heap()->undefined_value()) {
         // Lookup failure.
-        result = factory()->InternalizeOneByteString(
-            seq_source_, position_, length);
+        if (external_chars_ != NULL) {
+          result = factory()->InternalizeOneByteString(string_vector);
+        } else {
+          result = factory()->InternalizeOneByteString(seq_source_, position_,
+                                                       length);
+        }
         break;
       }
       if (element != isolate()->heap()->the_hole_value() &&
@@ -539,12 +539,14 @@ BasicJsonStringifier::Result BasicJsonStringifier::SerializeJSObject(
         FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
         Isolate* isolate = object->GetIsolate();
         if (object->IsUnboxedDoubleField(field_index)) {
-          double value = object->RawFastDoublePropertyAt(field_index);
-          property = isolate->factory()->NewHeapNumber(value);
-
-        } else {
-          property = handle(object->RawFastPropertyAt(field_index), isolate);
+          // Numbers have no toJSON to call, so serialize the value directly
+          // instead of boxing it first.
+          SerializeDeferredKey(comma, key);
+          SerializeDouble(object->RawFastDoublePropertyAt(field_index));
+          comma = true;
+          continue;
         }
+        property = handle(object->RawFastPropertyAt(field_index), isolate);
       } else {
         ASSIGN_RETURN_ON_EXCEPTION_VALUE(
             isolate_, property,
@@ -602,13 +604,19 @@ void BasicJsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
-  for (int i = 0; i < src.length(); i++) {
-    SrcChar c = src[i];
-    if (DoNotEscape(c)) {
-      dest->Append(c);
-    } else {
-      dest->AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
+  int length = src.length();
+  int i = 0;
+  while (i < length) {
+    // Copy runs of characters that need no escaping in one go. Most strings,
+    // and nearly all property keys, are a single such run.
+    int run_start = i;
+    while (i < length && DoNotEscape(src[i])) i++;
+    if (i > run_start) {
+      dest->AppendChars(src.start() + run_start, i - run_start);
+      if (i == length) break;
     }
+    SrcChar c = src[i++];
+    dest->AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
   }
 }
 
@@ -644,15 +652,11 @@ void BasicJsonStringifier::SerializeString_(Handle<String> string) {
 }
 
 
-template <>
-bool BasicJsonStringifier::DoNotEscape(uint8_t c) {
-  return c >= '#' && c <= '~' && c != '\\';
-}
-
-
-template <>
-bool BasicJsonStringifier::DoNotEscape(uint16_t c) {
-  return c >= '#' && c != '\\' && c != 0x7f;
+template <typename Char>
+bool BasicJsonStringifier::DoNotEscape(Char c) {
+  // Only control characters, quotes and backslashes have escape sequences;
+  // all other characters map to themselves in JsonEscapeTable.
+  return c >= 0x20 && c != '"' && c != '\\';
 }
 
 
@@ -17,6 +17,7 @@ const Register kReturnRegister0 = {kRegister_v0_Code};
 const Register kReturnRegister1 = {kRegister_v1_Code};
 const Register kJSFunctionRegister = {kRegister_a1_Code};
 const Register kContextRegister = {Register::kCpRegister};
+const Register kInterpreterAccumulatorRegister = {kRegister_v0_Code};
 const Register kInterpreterBytecodeOffsetRegister = {kRegister_t4_Code};
 const Register kInterpreterBytecodeArrayRegister = {kRegister_t5_Code};
 const Register kInterpreterDispatchTableRegister = {kRegister_t6_Code};
@@ -17,6 +17,7 @@ const Register kReturnRegister0 = {kRegister_v0_Code};
 const Register kReturnRegister1 = {kRegister_v1_Code};
 const Register kJSFunctionRegister = {kRegister_a1_Code};
 const Register kContextRegister = {kRegister_s7_Code};
+const Register kInterpreterAccumulatorRegister = {kRegister_v0_Code};
 const Register kInterpreterBytecodeOffsetRegister = {kRegister_t0_Code};
 const Register kInterpreterBytecodeArrayRegister = {kRegister_t1_Code};
 const Register kInterpreterDispatchTableRegister = {kRegister_t2_Code};
@@ -784,8 +784,15 @@ void JSRegExp::JSRegExpVerify() {
       CHECK(uc16_saved->IsSmi() || uc16_saved->IsString() ||
              uc16_saved->IsCode());
 
+      Object* one_byte_bytecode =
+          arr->get(JSRegExp::kIrregexpLatin1BytecodeIndex);
+      CHECK(one_byte_bytecode->IsSmi() || one_byte_bytecode->IsByteArray());
+      Object* uc16_bytecode = arr->get(JSRegExp::kIrregexpUC16BytecodeIndex);
+      CHECK(uc16_bytecode->IsSmi() || uc16_bytecode->IsByteArray());
+
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)->IsSmi());
       break;
     }
     default:
@@ -985,6 +992,7 @@ void Script::ScriptVerify() {
   type()->SmiVerify();
   VerifyPointer(line_ends());
   VerifyPointer(id());
+  VerifyPointer(preparse_data());
 }
 
 
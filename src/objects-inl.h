@@ -2934,12 +2934,16 @@ int DescriptorArray::SearchWithCache(Name* name, Map* map) {
   int number_of_own_descriptors = map->NumberOfOwnDescriptors();
   if (number_of_own_descriptors == 0) return kNotFound;
 
-  DescriptorLookupCache* cache = GetIsolate()->descriptor_lookup_cache();
+  Isolate* isolate = GetIsolate();
+  DescriptorLookupCache* cache = isolate->descriptor_lookup_cache();
   int number = cache->Lookup(map, name);
 
   if (number == DescriptorLookupCache::kAbsent) {
+    isolate->counters()->descriptor_lookup_cache_misses()->Increment();
     number = Search(name, number_of_own_descriptors);
     cache->Update(map, name, number);
+  } else {
+    isolate->counters()->descriptor_lookup_cache_hits()->Increment();
   }
 
   return number;
@@ -5600,6 +5604,7 @@ ACCESSORS(Script, shared_function_infos, Object, kSharedFunctionInfosOffset)
 ACCESSORS_TO_SMI(Script, flags, kFlagsOffset)
 ACCESSORS(Script, source_url, Object, kSourceUrlOffset)
 ACCESSORS(Script, source_mapping_url, Object, kSourceMappingUrlOffset)
+ACCESSORS(Script, preparse_data, Object, kPreparseDataOffset)
 
 Script::CompilationType Script::compilation_type() {
   return BooleanBit::get(flags(), kCompilationTypeBit) ?
@@ -5626,6 +5631,24 @@ void Script::set_origin_options(ScriptOriginOptions origin_options) {
   set_flags(Smi::FromInt((flags()->value() & ~kOriginOptionsMask) |
                          (origin_options.Flags() << kOriginOptionsShift)));
 }
+bool Script::has_serializable_code() {
+  return BooleanBit::get(flags(), kSerializableCodeBit);
+}
+void Script::set_has_serializable_code(bool value) {
+  set_flags(BooleanBit::set(flags(), kSerializableCodeBit, value));
+}
+bool Script::source_discarded() {
+  return BooleanBit::get(flags(), kSourceDiscardedBit);
+}
+void Script::set_source_discarded(bool value) {
+  set_flags(BooleanBit::set(flags(), kSourceDiscardedBit, value));
+}
+bool Script::calls_eval() {
+  return BooleanBit::get(flags(), kCallsEvalBit);
+}
+void Script::set_calls_eval(bool value) {
+  set_flags(BooleanBit::set(flags(), kCallsEvalBit, value));
+}
 
 
 ACCESSORS(DebugInfo, shared, SharedFunctionInfo, kSharedFunctionInfoIndex)
@@ -5907,6 +5930,12 @@ void SharedFunctionInfo::ReplaceCode(Code* value) {
 
   set_code(value);
 
+  // Full-codegen code supersedes the bytecode of an interpreted function, e.g.
+  // when it is recompiled for debugging or deoptimization support.
+  if (value->kind() == Code::FUNCTION && HasBytecodeArray()) {
+    set_function_data(GetHeap()->undefined_value());
+  }
+
   if (is_compiled()) set_never_compiled(false);
 }
 
@@ -852,7 +852,7 @@ void SharedFunctionInfo::SharedFunctionInfoPrint(std::ostream& os) {  // NOLINT
   os << "\n - instance class name = ";
   instance_class_name()->Print(os);
   os << "\n - code = " << Brief(code());
-  if (HasSourceCode()) {
+  if (HasSourceCode() && Script::cast(script())->source()->IsString()) {
     os << "\n - source code = ";
     String* source = String::cast(Script::cast(script())->source());
     int start = start_position();
@@ -1096,6 +1096,7 @@ void Script::ScriptPrint(std::ostream& os) {  // NOLINT
   os << "\n - eval from instructions offset: "
      << Brief(eval_from_instructions_offset());
   os << "\n - shared function infos: " << Brief(shared_function_infos());
+  os << "\n - preparse data: " << Brief(preparse_data());
   os << "\n";
 }
 
@@ -40,6 +40,7 @@
 #include "src/string-search.h"
 #include "src/string-stream.h"
 #include "src/utils.h"
+#include "src/vm-state-inl.h"
 
 #ifdef ENABLE_DISASSEMBLER
 #include "src/disasm.h"
@@ -10035,6 +10036,7 @@ void Script::InitLineEnds(Handle<Script> script) {
   if (!script->line_ends()->IsUndefined()) return;
 
   Isolate* isolate = script->GetIsolate();
+  EnsureSource(script);
 
   if (!script->source()->IsString()) {
     DCHECK(script->source()->IsUndefined());
@@ -10057,6 +10059,45 @@ void Script::InitLineEnds(Handle<Script> script) {
 }
 
 
+bool Script::CanDiscardSource() {
+  if (!source()->IsString()) return false;
+  // Only the embedder knows the source of top-level scripts.
+  if (type()->value() != TYPE_NORMAL) return false;
+  if (compilation_type() != COMPILATION_TYPE_HOST) return false;
+  // The eval cache hashes the source of the scripts that call eval. Scope
+  // info does not tell, as neither the script scope nor block scopes record
+  // their eval calls on the function.
+  if (calls_eval()) return false;
+  if (!shared_function_infos()->IsWeakFixedArray()) return false;
+  WeakFixedArray* array = WeakFixedArray::cast(shared_function_infos());
+  for (int i = 0; i < array->Length(); i++) {
+    Object* obj = array->Get(i);
+    if (!obj->IsSharedFunctionInfo()) continue;
+    SharedFunctionInfo* shared = SharedFunctionInfo::cast(obj);
+    // Lazy functions are parsed on their first call.
+    if (!shared->is_compiled()) return false;
+  }
+  return true;
+}
+
+
+void Script::EnsureSource(Handle<Script> script) {
+  if (script->source()->IsString() || !script->source_discarded()) return;
+  Isolate* isolate = script->GetIsolate();
+  v8::ScriptSourceCallback callback = isolate->script_source_callback();
+  CHECK(callback != NULL);
+  Handle<Object> name(script->name(), isolate);
+  v8::Local<v8::String> source;
+  {
+    VMState<EXTERNAL> state(isolate);
+    source = callback(reinterpret_cast<v8::Isolate*>(isolate),
+                      script->id()->value(), v8::Utils::ToLocal(name));
+  }
+  CHECK(!source.IsEmpty());
+  script->set_source(*v8::Utils::OpenHandle(*source));
+}
+
+
 int Script::GetColumnNumber(Handle<Script> script, int code_pos) {
   int line_number = GetLineNumber(script, code_pos);
   if (line_number == -1) return -1;
@@ -10223,16 +10264,21 @@ String* SharedFunctionInfo::DebugName() {
 
 
 bool SharedFunctionInfo::HasSourceCode() const {
-  return !script()->IsUndefined() &&
-         !reinterpret_cast<Script*>(script())->source()->IsUndefined();
+  if (script()->IsUndefined()) return false;
+  Script* script = reinterpret_cast<Script*>(this->script());
+  return !script->source()->IsUndefined() || script->source_discarded();
 }
 
 
 Handle<Object> SharedFunctionInfo::GetSourceCode() {
-  if (!HasSourceCode()) return GetIsolate()->factory()->undefined_value();
-  Handle<String> source(String::cast(Script::cast(script())->source()));
-  return GetIsolate()->factory()->NewSubString(
-      source, start_position(), end_position());
+  Isolate* isolate = GetIsolate();
+  if (!HasSourceCode()) return isolate->factory()->undefined_value();
+  int start = start_position();
+  int end = end_position();
+  Handle<Script> script(Script::cast(this->script()), isolate);
+  Script::EnsureSource(script);
+  Handle<String> source(String::cast(script->source()), isolate);
+  return isolate->factory()->NewSubString(source, start, end);
 }
 
 
@@ -10269,6 +10315,9 @@ std::ostream& operator<<(std::ostream& os, const SourceCodeOf& v) {
   const SharedFunctionInfo* s = v.value;
   // For some native functions there is no source.
   if (!s->HasSourceCode()) return os << "<No Source>";
+  if (!Script::cast(s->script())->source()->IsString()) {
+    return os << "<Discarded Source>";
+  }
 
   // Get the source for the script which this function came from.
   // Don't use String::cast because we don't want more assertion errors while
@@ -12405,6 +12454,55 @@ void JSObject::UpdateAllocationSite(Handle<JSObject> object,
 }
 
 
+// On hosts where a tagged slot and a double have the same size, a smi
+// backing store can be turned into a double backing store by rewriting each
+// slot and swapping the map, without allocating a second array. Returns
+// false if the transition has to go through a copy.
+static bool TransitionSmiToDoubleElementsInPlace(Handle<JSObject> object,
+                                                 ElementsKind from_kind,
+                                                 ElementsKind to_kind) {
+  if (!FLAG_in_place_elements_widening) return false;
+  if (kDoubleSize != kPointerSize ||
+      FixedArray::kHeaderSize != FixedDoubleArray::kHeaderSize) {
+    return false;
+  }
+  DCHECK(IsFastSmiElementsKind(from_kind));
+  DCHECK(IsFastDoubleElementsKind(to_kind));
+  Heap* heap = object->GetHeap();
+  // Copy-on-write backing stores are shared with the boilerplate.
+  if (object->elements()->map() != heap->fixed_array_map()) return false;
+  // Slots recorded by the marker must keep pointing at tagged values.
+  if (heap->incremental_marking()->IsMarking()) return false;
+
+  Handle<Map> new_map = JSObject::GetElementsTransitionMap(object, to_kind);
+  Handle<FixedArrayBase> elms(object->elements());
+  {
+    DisallowHeapAllocation no_gc;
+    FixedArray* smis = FixedArray::cast(*elms);
+    Object* the_hole = heap->the_hole_value();
+    int length = smis->length();
+    smis->set_map_no_write_barrier(heap->fixed_double_array_map());
+    FixedDoubleArray* doubles = FixedDoubleArray::cast(*elms);
+    for (int i = 0; i < length; i++) {
+      Object* value = Memory::Object_at(
+          elms->address() + FixedArray::OffsetOfElementAt(i));
+      if (value == the_hole) {
+        doubles->set_the_hole(i);
+      } else {
+        doubles->set(i, Smi::cast(value)->value());
+      }
+    }
+  }
+  JSObject::MigrateToMap(object, new_map);
+  heap->isolate()->counters()->elements_transitions_in_place()->Increment();
+  if (FLAG_trace_elements_transitions) {
+    JSObject::PrintElementsTransition(stdout, object, from_kind, elms, to_kind,
+                                      elms);
+  }
+  return true;
+}
+
+
 void JSObject::TransitionElementsKind(Handle<JSObject> object,
                                       ElementsKind to_kind) {
   ElementsKind from_kind = object->GetElementsKind();
@@ -12437,8 +12535,16 @@ void JSObject::TransitionElementsKind(Handle<JSObject> object,
             IsFastDoubleElementsKind(to_kind)) ||
            (IsFastDoubleElementsKind(from_kind) &&
             IsFastObjectElementsKind(to_kind)));
+    if (IsFastSmiElementsKind(from_kind) &&
+        TransitionSmiToDoubleElementsInPlace(object, from_kind, to_kind)) {
+      return;
+    }
     uint32_t c = static_cast<uint32_t>(object->elements()->length());
     ElementsAccessor::ForKind(to_kind)->GrowCapacityAndConvert(object, c);
+    Counters* counters = object->GetIsolate()->counters();
+    counters->elements_transitions_copying()->Increment();
+    counters->elements_transitions_copied_bytes()->Increment(
+        object->elements()->Size());
   }
 }
 
@@ -13098,6 +13204,7 @@ class StringSharedKey : public HashTableKey {
       // We do this to ensure that the cache entries can survive garbage
       // collection.
       Script* script(Script::cast(shared->script()));
+      CHECK(script->source()->IsString());
       hash ^= String::cast(script->source())->Hash();
       STATIC_ASSERT(LANGUAGE_END == 3);
       if (is_strict(language_mode)) hash ^= 0x8000;
@@ -14067,8 +14174,22 @@ void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
 
 Handle<String> StringTable::LookupString(Isolate* isolate,
                                          Handle<String> string) {
+  if (string->IsConsString() && string->IsFlat()) {
+    string = String::Flatten(string);
+    if (string->IsInternalizedString()) return string;
+  }
+
   InternalizedStringKey key(string);
-  return LookupKey(isolate, &key);
+  Handle<String> result = LookupKey(isolate, &key);
+
+  if (string->IsConsString()) {
+    // Let the rope point at its internalized version. Using it as a key again
+    // then neither hashes nor compares the rope, and flattening it is free.
+    Handle<ConsString> cons = Handle<ConsString>::cast(string);
+    cons->set_first(*result);
+    cons->set_second(isolate->heap()->empty_string());
+  }
+  return result;
 }
 
 
@@ -14108,9 +14229,19 @@ String* StringTable::LookupKeyIfExists(Isolate* isolate, HashTableKey* key) {
 }
 
 
+Handle<CompilationCacheTable> CompilationCacheTable::New(
+    Isolate* isolate, int at_least_space_for) {
+  Handle<CompilationCacheTable> table =
+      HashTable::New(isolate, at_least_space_for);
+  table->SetLiveBytes(0);
+  return table;
+}
+
+
 Handle<Object> CompilationCacheTable::Lookup(Handle<String> src,
                                              Handle<Context> context,
-                                             LanguageMode language_mode) {
+                                             LanguageMode language_mode,
+                                             int use_stamp) {
   Isolate* isolate = GetIsolate();
   Handle<SharedFunctionInfo> shared(context->closure()->shared());
   StringSharedKey key(src, shared, language_mode, RelocInfo::kNoPosition);
@@ -14118,13 +14249,14 @@ Handle<Object> CompilationCacheTable::Lookup(Handle<String> src,
   if (entry == kNotFound) return isolate->factory()->undefined_value();
   int index = EntryToIndex(entry);
   if (!get(index)->IsFixedArray()) return isolate->factory()->undefined_value();
+  set(index + 2, Smi::FromInt(use_stamp));
   return Handle<Object>(get(index + 1), isolate);
 }
 
 
 Handle<Object> CompilationCacheTable::LookupEval(
     Handle<String> src, Handle<SharedFunctionInfo> outer_info,
-    LanguageMode language_mode, int scope_position) {
+    LanguageMode language_mode, int scope_position, int use_stamp) {
   Isolate* isolate = GetIsolate();
   // Cache key is the tuple (source, outer shared function info, scope position)
   // to unambiguously identify the context chain the cached eval code assumes.
@@ -14133,6 +14265,7 @@ Handle<Object> CompilationCacheTable::LookupEval(
   if (entry == kNotFound) return isolate->factory()->undefined_value();
   int index = EntryToIndex(entry);
   if (!get(index)->IsFixedArray()) return isolate->factory()->undefined_value();
+  set(index + 2, Smi::FromInt(use_stamp));
   return Handle<Object>(get(EntryToIndex(entry) + 1), isolate);
 }
 
@@ -14150,7 +14283,8 @@ Handle<Object> CompilationCacheTable::LookupRegExp(Handle<String> src,
 
 Handle<CompilationCacheTable> CompilationCacheTable::Put(
     Handle<CompilationCacheTable> cache, Handle<String> src,
-    Handle<Context> context, LanguageMode language_mode, Handle<Object> value) {
+    Handle<Context> context, LanguageMode language_mode, Handle<Object> value,
+    int use_stamp) {
   Isolate* isolate = cache->GetIsolate();
   Handle<SharedFunctionInfo> shared(context->closure()->shared());
   StringSharedKey key(src, shared, language_mode, RelocInfo::kNoPosition);
@@ -14159,8 +14293,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::Put(
     DisallowHeapAllocation no_allocation_scope;
     int entry = cache->FindEntry(&key);
     if (entry != kNotFound) {
-      cache->set(EntryToIndex(entry), *k);
-      cache->set(EntryToIndex(entry) + 1, *value);
+      cache->StoreEntry(entry, *k, *value, use_stamp);
       return cache;
     }
   }
@@ -14169,8 +14302,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::Put(
   int entry = cache->FindInsertionEntry(key.Hash());
   Handle<Object> k =
       isolate->factory()->NewNumber(static_cast<double>(key.Hash()));
-  cache->set(EntryToIndex(entry), *k);
-  cache->set(EntryToIndex(entry) + 1, Smi::FromInt(kHashGenerations));
+  cache->StoreEntry(entry, *k, Smi::FromInt(kHashGenerations), use_stamp);
   cache->ElementAdded();
   return cache;
 }
@@ -14179,7 +14311,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::Put(
 Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
     Handle<CompilationCacheTable> cache, Handle<String> src,
     Handle<SharedFunctionInfo> outer_info, Handle<SharedFunctionInfo> value,
-    int scope_position) {
+    int scope_position, int use_stamp) {
   Isolate* isolate = cache->GetIsolate();
   StringSharedKey key(src, outer_info, value->language_mode(), scope_position);
   {
@@ -14187,8 +14319,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
     DisallowHeapAllocation no_allocation_scope;
     int entry = cache->FindEntry(&key);
     if (entry != kNotFound) {
-      cache->set(EntryToIndex(entry), *k);
-      cache->set(EntryToIndex(entry) + 1, *value);
+      cache->StoreEntry(entry, *k, *value, use_stamp);
       return cache;
     }
   }
@@ -14197,8 +14328,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
   int entry = cache->FindInsertionEntry(key.Hash());
   Handle<Object> k =
       isolate->factory()->NewNumber(static_cast<double>(key.Hash()));
-  cache->set(EntryToIndex(entry), *k);
-  cache->set(EntryToIndex(entry) + 1, Smi::FromInt(kHashGenerations));
+  cache->StoreEntry(entry, *k, Smi::FromInt(kHashGenerations), use_stamp);
   cache->ElementAdded();
   return cache;
 }
@@ -14214,14 +14344,16 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutRegExp(
   // to the stored value with a custon IsMatch function during lookups.
   cache->set(EntryToIndex(entry), *value);
   cache->set(EntryToIndex(entry) + 1, *value);
+  cache->set(EntryToIndex(entry) + 2, Smi::FromInt(0));
+  cache->set(EntryToIndex(entry) + 3, Smi::FromInt(0));
   cache->ElementAdded();
   return cache;
 }
 
 
-void CompilationCacheTable::Age() {
+int CompilationCacheTable::Age(int used_since) {
   DisallowHeapAllocation no_allocation;
-  Object* the_hole_value = GetHeap()->the_hole_value();
+  int removed = 0;
   for (int entry = 0, size = Capacity(); entry < size; entry++) {
     int entry_index = EntryToIndex(entry);
     int value_index = entry_index + 1;
@@ -14230,35 +14362,90 @@ void CompilationCacheTable::Age() {
       Smi* count = Smi::cast(get(value_index));
       count = Smi::FromInt(count->value() - 1);
       if (count->value() == 0) {
-        NoWriteBarrierSet(this, entry_index, the_hole_value);
-        NoWriteBarrierSet(this, value_index, the_hole_value);
-        ElementRemoved();
+        RemoveEntry(entry);
       } else {
         NoWriteBarrierSet(this, value_index, count);
       }
     } else if (get(entry_index)->IsFixedArray()) {
       SharedFunctionInfo* info = SharedFunctionInfo::cast(get(value_index));
-      if (info->code()->kind() != Code::FUNCTION || info->code()->IsOld()) {
-        NoWriteBarrierSet(this, entry_index, the_hole_value);
-        NoWriteBarrierSet(this, value_index, the_hole_value);
-        ElementRemoved();
+      if (info->code()->kind() != Code::FUNCTION) {
+        RemoveEntry(entry);
+        removed++;
+      } else if (info->code()->IsOld() && UseStampAt(entry) < used_since) {
+        RemoveEntry(entry);
+        removed++;
       }
     }
   }
+  return removed;
+}
+
+
+bool CompilationCacheTable::IsLiveEntry(int entry) {
+  return KeyAt(entry)->IsFixedArray() &&
+         get(EntryToIndex(entry) + 1)->IsSharedFunctionInfo();
+}
+
+
+int CompilationCacheTable::UseStampAt(int entry) {
+  return Smi::cast(get(EntryToIndex(entry) + 2))->value();
+}
+
+
+size_t CompilationCacheTable::EntrySizeAt(int entry) {
+  DCHECK(IsLiveEntry(entry));
+  return Smi::cast(get(EntryToIndex(entry) + 3))->value();
+}
+
+
+size_t CompilationCacheTable::LiveBytes() {
+  return Smi::cast(get(kLiveBytesIndex))->value();
+}
+
+
+void CompilationCacheTable::SetLiveBytes(size_t bytes) {
+  DCHECK(bytes <= static_cast<size_t>(Smi::kMaxValue));
+  set(kLiveBytesIndex, Smi::FromInt(static_cast<int>(bytes)));
+}
+
+
+void CompilationCacheTable::StoreEntry(int entry, Object* key, Object* value,
+                                       int use_stamp) {
+  if (IsLiveEntry(entry)) SetLiveBytes(LiveBytes() - EntrySizeAt(entry));
+  int entry_index = EntryToIndex(entry);
+  set(entry_index, key);
+  set(entry_index + 1, value);
+  set(entry_index + 2, Smi::FromInt(use_stamp));
+  size_t size = 0;
+  if (IsLiveEntry(entry)) {
+    SharedFunctionInfo* info = SharedFunctionInfo::cast(value);
+    size = String::cast(FixedArray::cast(key)->get(1))->Size() +
+           info->code()->Size();
+    // Keep the total representable as a Smi.
+    size = Min(size, static_cast<size_t>(Smi::kMaxValue) - LiveBytes());
+    SetLiveBytes(LiveBytes() + size);
+  }
+  set(entry_index + 3, Smi::FromInt(static_cast<int>(size)));
+}
+
+
+void CompilationCacheTable::RemoveEntry(int entry) {
+  if (IsLiveEntry(entry)) SetLiveBytes(LiveBytes() - EntrySizeAt(entry));
+  Object* the_hole_value = GetHeap()->the_hole_value();
+  int entry_index = EntryToIndex(entry);
+  NoWriteBarrierSet(this, entry_index, the_hole_value);
+  NoWriteBarrierSet(this, entry_index + 1, the_hole_value);
+  NoWriteBarrierSet(this, entry_index + 2, the_hole_value);
+  NoWriteBarrierSet(this, entry_index + 3, the_hole_value);
+  ElementRemoved();
 }
 
 
 void CompilationCacheTable::Remove(Object* value) {
   DisallowHeapAllocation no_allocation;
-  Object* the_hole_value = GetHeap()->the_hole_value();
   for (int entry = 0, size = Capacity(); entry < size; entry++) {
-    int entry_index = EntryToIndex(entry);
-    int value_index = entry_index + 1;
-    if (get(value_index) == value) {
-      NoWriteBarrierSet(this, entry_index, the_hole_value);
-      NoWriteBarrierSet(this, value_index, the_hole_value);
-      ElementRemoved();
-    }
+    int value_index = EntryToIndex(entry) + 1;
+    if (get(value_index) == value) RemoveEntry(entry);
   }
   return;
 }
@@ -5931,6 +5931,11 @@ class Script: public Struct {
   // [source_url]: sourceMappingURL magic comment
   DECL_ACCESSORS(source_mapping_url, Object)
 
+  // [preparse_data]: ObjectHashTable mapping the start position of functions
+  // that have not been compiled yet to the preparse data of their inner
+  // functions, or undefined.
+  DECL_ACCESSORS(preparse_data, Object)
+
   // [compilation_type]: how the the script was compiled. Encoded in the
   // 'flags' field.
   inline CompilationType compilation_type();
@@ -5947,6 +5952,23 @@ class Script: public Struct {
   inline v8::ScriptOriginOptions origin_options();
   inline void set_origin_options(ScriptOriginOptions origin_options);
 
+  // [has_serializable_code]: whether code for functions in this script is
+  // generated so that it can be included in a code cache, including code
+  // that is compiled lazily. Encoded in the 'flags' field.
+  inline bool has_serializable_code();
+  inline void set_has_serializable_code(bool value);
+
+  // [source_discarded]: whether the source was dropped to save memory and
+  // has to be requested from the embedder when it is needed again. Encoded
+  // in the 'flags' field.
+  inline bool source_discarded();
+  inline void set_source_discarded(bool value);
+
+  // [calls_eval]: whether the parser has seen a direct eval call anywhere in
+  // the script. Encoded in the 'flags' field.
+  inline bool calls_eval();
+  inline void set_calls_eval(bool value);
+
   DECLARE_CAST(Script)
 
   // If script source is an external string, check that the underlying
@@ -5966,6 +5988,13 @@ class Script: public Struct {
   // Init line_ends array with code positions of line ends inside script source.
   static void InitLineEnds(Handle<Script> script);
 
+  // Whether the source can be discarded because every function of the script
+  // has been compiled, see Isolate::DiscardScriptSources.
+  bool CanDiscardSource();
+
+  // Requests a discarded source back from the embedder.
+  static void EnsureSource(Handle<Script> script);
+
   // Get the JS object wrapping the given script; create it if none exists.
   static Handle<JSObject> GetWrapper(Handle<Script> script);
 
@@ -5994,7 +6023,8 @@ class Script: public Struct {
   static const int kFlagsOffset = kSharedFunctionInfosOffset + kPointerSize;
   static const int kSourceUrlOffset = kFlagsOffset + kPointerSize;
   static const int kSourceMappingUrlOffset = kSourceUrlOffset + kPointerSize;
-  static const int kSize = kSourceMappingUrlOffset + kPointerSize;
+  static const int kPreparseDataOffset = kSourceMappingUrlOffset + kPointerSize;
+  static const int kSize = kPreparseDataOffset + kPointerSize;
 
  private:
   int GetLineNumberWithArray(int code_pos);
@@ -6006,6 +6036,10 @@ class Script: public Struct {
   static const int kOriginOptionsSize = 3;
   static const int kOriginOptionsMask = ((1 << kOriginOptionsSize) - 1)
                                         << kOriginOptionsShift;
+  static const int kSerializableCodeBit =
+      kOriginOptionsShift + kOriginOptionsSize;
+  static const int kSourceDiscardedBit = kSerializableCodeBit + 1;
+  static const int kCallsEvalBit = kSourceDiscardedBit + 1;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(Script);
 };
@@ -7346,6 +7380,14 @@ class JSRegExp: public JSObject {
     }
   }
 
+  static int bytecode_index(bool is_latin1) {
+    if (is_latin1) {
+      return kIrregexpLatin1BytecodeIndex;
+    } else {
+      return kIrregexpUC16BytecodeIndex;
+    }
+  }
+
   DECLARE_CAST(JSRegExp)
 
   // Dispatched behavior.
@@ -7387,8 +7429,15 @@ class JSRegExp: public JSObject {
   static const int kIrregexpMaxRegisterCountIndex = kDataIndex + 4;
   // Number of captures in the compiled regexp.
   static const int kIrregexpCaptureCountIndex = kDataIndex + 5;
+  // Irregexp bytecode for Latin1 and UC16 used before tier-up when native
+  // regexp code is supported, see --regexp-tier-up.
+  static const int kIrregexpLatin1BytecodeIndex = kDataIndex + 6;
+  static const int kIrregexpUC16BytecodeIndex = kDataIndex + 7;
+  // Number of executions left in the bytecode interpreter before the regexp
+  // is compiled to native code, or kTieredUpValue once it runs native code.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 8;
 
-  static const int kIrregexpDataSize = kIrregexpCaptureCountIndex + 1;
+  static const int kIrregexpDataSize = kIrregexpTicksUntilTierUpIndex + 1;
 
   // Offsets directly into the data fixed array.
   static const int kDataTagOffset =
@@ -7415,6 +7464,9 @@ class JSRegExp: public JSObject {
   // object is in the saved code field.
   static const int kCompilationErrorValue = -2;
 
+  // The tier-up tick count of a regexp that runs native code.
+  static const int kTieredUpValue = -1;
+
   // When we store the sweep generation at which we moved the code from the
   // code index to the saved code index we mask it of to be in the [0:255]
   // range.
@@ -7438,8 +7490,10 @@ class CompilationCacheShape : public BaseShape<HashTableKey*> {
 
   static inline Handle<Object> AsHandle(Isolate* isolate, HashTableKey* key);
 
-  static const int kPrefixSize = 0;
-  static const int kEntrySize = 2;
+  // The number of bytes retained by the live entries.
+  static const int kPrefixSize = 1;
+  // Key, value, the use stamp and the size of the entry.
+  static const int kEntrySize = 4;
 };
 
 
@@ -7454,35 +7508,64 @@ class CompilationCacheShape : public BaseShape<HashTableKey*> {
 // Such entries are identified by SharedFunctionInfos pointing to either the
 // recompilation stub, or to "old" code. This avoids memory leaks due to
 // premature caching of scripts and eval strings that are never needed later.
+// Live entries carry the stamp of their last use, which protects entries that
+// are still being hit from being aged out, and orders them for LRU eviction.
 class CompilationCacheTable: public HashTable<CompilationCacheTable,
                                               CompilationCacheShape,
                                               HashTableKey*> {
  public:
-  // Find cached value for a string key, otherwise return null.
-  Handle<Object> Lookup(
-      Handle<String> src, Handle<Context> context, LanguageMode language_mode);
-  Handle<Object> LookupEval(
-      Handle<String> src, Handle<SharedFunctionInfo> shared,
-      LanguageMode language_mode, int scope_position);
+  static Handle<CompilationCacheTable> New(Isolate* isolate,
+                                           int at_least_space_for);
+
+  // Find cached value for a string key, otherwise return null. A hit updates
+  // the use stamp of the entry.
+  Handle<Object> Lookup(Handle<String> src, Handle<Context> context,
+                        LanguageMode language_mode, int use_stamp);
+  Handle<Object> LookupEval(Handle<String> src,
+                            Handle<SharedFunctionInfo> shared,
+                            LanguageMode language_mode, int scope_position,
+                            int use_stamp);
   Handle<Object> LookupRegExp(Handle<String> source, JSRegExp::Flags flags);
   static Handle<CompilationCacheTable> Put(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<Context> context, LanguageMode language_mode,
-      Handle<Object> value);
+      Handle<Object> value, int use_stamp);
   static Handle<CompilationCacheTable> PutEval(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<SharedFunctionInfo> context, Handle<SharedFunctionInfo> value,
-      int scope_position);
+      int scope_position, int use_stamp);
   static Handle<CompilationCacheTable> PutRegExp(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       JSRegExp::Flags flags, Handle<FixedArray> value);
   void Remove(Object* value);
-  void Age();
+  // Removes stale entries, but keeps those used at or after |used_since|.
+  // Returns the number of removed live entries.
+  int Age(int used_since);
+
+  // Access to the live (i.e. not hash-only) entries of script and eval caches,
+  // used to keep the cache within its byte budget.
+  bool IsLiveEntry(int entry);
+  int UseStampAt(int entry);
+  // The approximate number of bytes retained by a live entry, as computed
+  // when it was stored.
+  size_t EntrySizeAt(int entry);
+  void RemoveEntry(int entry);
+
+  // The sum of the sizes of all live entries.
+  size_t LiveBytes();
+
   static const int kHashGenerations = 10;
 
   DECLARE_CAST(CompilationCacheTable)
 
  private:
+  static const int kLiveBytesIndex = kPrefixStartIndex;
+
+  void SetLiveBytes(size_t bytes);
+  // Stores an entry, keeping the live bytes up to date if the previous or the
+  // new value is live.
+  void StoreEntry(int entry, Object* key, Object* value, int use_stamp);
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheTable);
 };
 
@@ -528,6 +528,7 @@ void ParserTraits::CheckPossibleEvalCall(Expression* expression,
       callee->raw_name() == parser_->ast_value_factory()->eval_string()) {
     scope->DeclarationScope()->RecordEvalCall();
     scope->RecordEvalCall();
+    parser_->calls_eval_ = true;
   }
 }
 
@@ -903,7 +904,11 @@ Parser::Parser(ParseInfo* info)
       compile_options_(info->compile_options()),
       cached_parse_data_(NULL),
       total_preparse_skipped_(0),
+      total_preparsed_functions_(0),
       pre_parse_timer_(NULL),
+      eager_top_level_functions_(info->eager_top_level_functions()),
+      record_inner_functions_(FLAG_reuse_preparse_data),
+      calls_eval_(false),
       parsing_on_main_thread_(true) {
   // Even though we were passed ParseInfo, we should not store it in
   // Parser - this makes sure that Isolate is not accidentally accessed via
@@ -1109,6 +1114,9 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
     timer.Start();
   }
   Handle<SharedFunctionInfo> shared_info = info->shared_info();
+  if (record_inner_functions_) {
+    TakeInnerFunctions(isolate, info->script(), shared_info->start_position());
+  }
 
   // Initialize parser state.
   source = String::Flatten(source);
@@ -4097,6 +4105,13 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
                             !parenthesized_function_;
     parenthesized_function_ = false;  // The bit was set for this function only.
 
+    // When parsing off the main thread, the cost of a full parse is hidden,
+    // whereas preparsing here means reparsing on the main thread later.
+    if (is_lazily_parsed && eager_top_level_functions_) {
+      is_lazily_parsed = false;
+      eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
+    }
+
     // Eager or lazy parse?
     // If is_lazily_parsed, we'll parse lazy. If we can set a bookmark, we'll
     // pass it to SkipLazyFunctionBody, which may use it to abort lazy
@@ -4184,6 +4199,27 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 }
 
 
+// Returns the index of the entry for the function body starting at start_pos
+// in entries sorted by start position, or -1 if there is none.
+static int FindFunctionEntry(Vector<const unsigned> entries, int start_pos) {
+  int low = 0;
+  int high = entries.length() / FunctionEntry::kSize;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    int index = mid * FunctionEntry::kSize;
+    int mid_pos =
+        static_cast<int>(entries[index + FunctionEntry::kStartPositionIndex]);
+    if (mid_pos == start_pos) return index;
+    if (mid_pos < start_pos) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return -1;
+}
+
+
 void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
                                   int* expected_property_count, bool* ok,
                                   Scanner::BookmarkScope* bookmark) {
@@ -4212,16 +4248,67 @@ void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
       *expected_property_count = entry.property_count();
       scope_->SetLanguageMode(entry.language_mode());
       if (entry.uses_super_property()) scope_->RecordSuperPropertyUsage();
-      if (entry.calls_eval()) scope_->RecordEvalCall();
+      if (entry.calls_eval()) {
+        scope_->RecordEvalCall();
+        calls_eval_ = true;
+      }
       return;
     }
     cached_parse_data_->Reject();
   }
+  // The function may have been preparsed already as part of the enclosing
+  // function's body, in which case its entry is among the inner functions.
+  int index = FindFunctionEntry(inner_function_entries_, function_block_pos);
+  if (index >= 0) {
+    Vector<const unsigned> entries = inner_function_entries_;
+    FunctionEntry entry(Vector<unsigned>(
+        const_cast<unsigned*>(&entries[index]), FunctionEntry::kSize));
+    scanner()->SeekForward(entry.end_pos() - 1);
+
+    scope_->set_end_position(entry.end_pos());
+    Expect(Token::RBRACE, ok);
+    if (!*ok) {
+      return;
+    }
+    total_preparse_skipped_ += scope_->end_position() - function_block_pos;
+    *materialized_literal_count = entry.literal_count();
+    *expected_property_count = entry.property_count();
+    scope_->SetLanguageMode(entry.language_mode());
+    if (entry.uses_super_property()) scope_->RecordSuperPropertyUsage();
+    if (entry.calls_eval()) {
+      scope_->RecordEvalCall();
+      calls_eval_ = true;
+    }
+
+    // The entries of its own inner functions directly follow it; pass them on
+    // to the compilation of this function.
+    int first = index + FunctionEntry::kSize;
+    int last = first;
+    while (last < entries.length()) {
+      FunctionEntry inner(Vector<unsigned>(
+          const_cast<unsigned*>(&entries[last]), FunctionEntry::kSize));
+      if (inner.start_pos() >= entry.end_pos()) break;
+      last += FunctionEntry::kSize;
+    }
+    if (record_inner_functions_) {
+      RecordInnerFunctions(scope_->start_position(),
+                           entries.SubVector(first, last));
+    }
+    if (produce_cached_parse_data()) {
+      DCHECK(log_);
+      log_->LogFunction(function_block_pos, entry.end_pos(),
+                        *materialized_literal_count, *expected_property_count,
+                        scope_->language_mode(), scope_->uses_super_property(),
+                        scope_->calls_eval());
+    }
+    return;
+  }
   // With no cached data, we partially parse the function, without building an
   // AST. This gathers the data needed to build a lazy function.
   SingletonLogger logger;
-  PreParser::PreParseResult result =
-      ParseLazyFunctionBodyWithPreParser(&logger, bookmark);
+  CompleteParserRecorder inner_function_log;
+  PreParser::PreParseResult result = ParseLazyFunctionBodyWithPreParser(
+      &logger, bookmark, record_inner_functions_ ? &inner_function_log : NULL);
   if (bookmark && bookmark->HasBeenReset()) {
     return;  // Return immediately if pre-parser devided to abort parsing.
   }
@@ -4252,6 +4339,14 @@ void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
   }
   if (logger.calls_eval()) {
     scope_->RecordEvalCall();
+    calls_eval_ = true;
+  }
+  if (record_inner_functions_) {
+    Vector<unsigned> entries = inner_function_log.FunctionEntries();
+    RecordInnerFunctions(
+        scope_->start_position(),
+        Vector<const unsigned>(entries.start(), entries.length()));
+    entries.Dispose();
   }
   if (produce_cached_parse_data()) {
     DCHECK(log_);
@@ -4479,12 +4574,14 @@ ZoneList<Statement*>* Parser::ParseEagerFunctionBody(
 
 
 PreParser::PreParseResult Parser::ParseLazyFunctionBodyWithPreParser(
-    SingletonLogger* logger, Scanner::BookmarkScope* bookmark) {
+    SingletonLogger* logger, Scanner::BookmarkScope* bookmark,
+    CompleteParserRecorder* inner_function_log) {
   // This function may be called on a background thread too; record only the
   // main thread preparse times.
   if (pre_parse_timer_ != NULL) {
     pre_parse_timer_->Start();
   }
+  total_preparsed_functions_++;
   DCHECK_EQ(Token::LBRACE, scanner()->current_token());
 
   if (reusable_preparser_ == NULL) {
@@ -4505,7 +4602,8 @@ PreParser::PreParseResult Parser::ParseLazyFunctionBodyWithPreParser(
 #undef SET_ALLOW
   }
   PreParser::PreParseResult result = reusable_preparser_->PreParseLazyFunction(
-      language_mode(), function_state_->kind(), logger, bookmark);
+      language_mode(), function_state_->kind(), logger, bookmark,
+      inner_function_log);
   if (pre_parse_timer_ != NULL) {
     pre_parse_timer_->Stop();
   }
@@ -4513,6 +4611,82 @@ PreParser::PreParseResult Parser::ParseLazyFunctionBodyWithPreParser(
 }
 
 
+void Parser::RecordInnerFunctions(int start_position,
+                                  Vector<const unsigned> entries) {
+  if (entries.is_empty()) return;
+  DCHECK_EQ(0, entries.length() % FunctionEntry::kSize);
+  if (entries.length() > kMaxInnerFunctionEntries * FunctionEntry::kSize) {
+    return;
+  }
+  // The preparser completes inner functions before their enclosing functions,
+  // so sort the entries by start position.
+  int count = entries.length() / FunctionEntry::kSize;
+  int* order = zone()->NewArray<int>(count);
+  for (int i = 0; i < count; i++) order[i] = i * FunctionEntry::kSize;
+  std::sort(order, order + count, [entries](int a, int b) {
+    return entries[a + FunctionEntry::kStartPositionIndex] <
+           entries[b + FunctionEntry::kStartPositionIndex];
+  });
+  unsigned* sorted = zone()->NewArray<unsigned>(entries.length());
+  for (int i = 0; i < count; i++) {
+    MemCopy(sorted + i * FunctionEntry::kSize, &entries[order[i]],
+            FunctionEntry::kSize * sizeof(unsigned));
+  }
+  InnerFunctions inner = {
+      start_position, Vector<const unsigned>(sorted, entries.length())};
+  recorded_inner_functions_.Add(inner);
+}
+
+
+void Parser::TakeInnerFunctions(Isolate* isolate, Handle<Script> script,
+                                int start_position) {
+  if (script.is_null() || !script->preparse_data()->IsObjectHashTable()) {
+    return;
+  }
+  Handle<ObjectHashTable> table(
+      ObjectHashTable::cast(script->preparse_data()), isolate);
+  Handle<Object> key(Smi::FromInt(start_position), isolate);
+  Object* data = table->Lookup(key);
+  if (!data->IsByteArray()) return;
+  ByteArray* bytes = ByteArray::cast(data);
+  int length = bytes->length() / static_cast<int>(sizeof(unsigned));
+  unsigned* entries = zone()->NewArray<unsigned>(length);
+  MemCopy(entries, bytes->GetDataStartAddress(), length * sizeof(unsigned));
+  inner_function_entries_ = Vector<const unsigned>(entries, length);
+  // A function is compiled lazily at most once; should its code be flushed,
+  // the inner functions are simply preparsed again.
+  bool was_present;
+  table = ObjectHashTable::Remove(table, key, &was_present);
+  if (table->NumberOfElements() == 0) {
+    script->set_preparse_data(isolate->heap()->undefined_value());
+  } else {
+    script->set_preparse_data(*table);
+  }
+}
+
+
+void Parser::PublishInnerFunctions(Isolate* isolate, Handle<Script> script) {
+  if (recorded_inner_functions_.is_empty()) return;
+  Handle<ObjectHashTable> table;
+  if (script->preparse_data()->IsObjectHashTable()) {
+    table = handle(ObjectHashTable::cast(script->preparse_data()), isolate);
+  } else {
+    table = ObjectHashTable::New(isolate, recorded_inner_functions_.length());
+  }
+  for (int i = 0; i < recorded_inner_functions_.length(); i++) {
+    if (table->NumberOfElements() >= kMaxPreparseDataFunctions) break;
+    const InnerFunctions& inner = recorded_inner_functions_[i];
+    int length = inner.entries.length() * static_cast<int>(sizeof(unsigned));
+    Handle<ByteArray> bytes = isolate->factory()->NewByteArray(length, TENURED);
+    MemCopy(bytes->GetDataStartAddress(), inner.entries.start(), length);
+    table = ObjectHashTable::Put(
+        table, handle(Smi::FromInt(inner.start_position), isolate), bytes);
+  }
+  script->set_preparse_data(*table);
+  recorded_inner_functions_.Clear();
+}
+
+
 ClassLiteral* Parser::ParseClassLiteral(const AstRawString* name,
                                         Scanner::Location class_name_location,
                                         bool name_is_strict_reserved, int pos,
@@ -4781,6 +4955,11 @@ void Parser::Internalize(Isolate* isolate, Handle<Script> script, bool error) {
   }
   isolate->counters()->total_preparse_skipped()->Increment(
       total_preparse_skipped_);
+  isolate->counters()->total_preparsed_functions()->Increment(
+      total_preparsed_functions_);
+
+  if (!script.is_null() && calls_eval_) script->set_calls_eval(true);
+  if (!error && !script.is_null()) PublishInnerFunctions(isolate, script);
 }
 
 
@@ -5714,6 +5893,7 @@ bool Parser::Parse(ParseInfo* info) {
   DCHECK(parsing_on_main_thread_);
   Isolate* isolate = info->isolate();
   pre_parse_timer_ = isolate->counters()->pre_parse();
+  Script::EnsureSource(info->script());
   if (FLAG_trace_parse || allow_natives() || extension_ != NULL) {
     // If intrinsics are allowed, the Parser cannot operate independent of the
     // V8 heap because of Runtime. Tell the string table to internalize strings
@@ -5721,6 +5901,11 @@ bool Parser::Parse(ParseInfo* info) {
     ast_value_factory()->Internalize(isolate);
   }
 
+  // Preparse data of inner functions is only kept for the first compilation.
+  if (!info->shared_info().is_null() && info->shared_info()->is_compiled()) {
+    record_inner_functions_ = false;
+  }
+
   if (info->is_lazy()) {
     DCHECK(!info->is_eval());
     if (info->shared_info()->is_function()) {
@@ -56,6 +56,8 @@ class ParseInfo {
   FLAG_ACCESSOR(kNative, is_native, set_native)
   FLAG_ACCESSOR(kModule, is_module, set_module)
   FLAG_ACCESSOR(kAllowLazyParsing, allow_lazy_parsing, set_allow_lazy_parsing)
+  FLAG_ACCESSOR(kEagerTopLevelFunctions, eager_top_level_functions,
+                set_eager_top_level_functions)
   FLAG_ACCESSOR(kAstValueFactoryOwned, ast_value_factory_owned,
                 set_ast_value_factory_owned)
 
@@ -168,8 +170,9 @@ class ParseInfo {
     kParseRestriction = 1 << 7,
     kModule = 1 << 8,
     kAllowLazyParsing = 1 << 9,
+    kEagerTopLevelFunctions = 1 << 10,
     // ---------- Output flags --------------------------
-    kAstValueFactoryOwned = 1 << 10
+    kAstValueFactoryOwned = 1 << 11
   };
 
   //------------- Inputs to parsing and scope analysis -----------------------
@@ -1157,7 +1160,20 @@ class Parser : public ParserBase<ParserTraits> {
                             Scanner::BookmarkScope* bookmark = nullptr);
 
   PreParser::PreParseResult ParseLazyFunctionBodyWithPreParser(
-      SingletonLogger* logger, Scanner::BookmarkScope* bookmark = nullptr);
+      SingletonLogger* logger, Scanner::BookmarkScope* bookmark = nullptr,
+      CompleteParserRecorder* inner_function_log = nullptr);
+
+  // Preparse data of the functions nested in lazily parsed function bodies is
+  // kept on the script, keyed by the start position of the enclosing function,
+  // so that compiling that function does not preparse them again. The data is
+  // bounded by kMaxPreparseDataFunctions enclosing functions per script, with
+  // at most kMaxInnerFunctionEntries inner functions each.
+  static const int kMaxPreparseDataFunctions = 64;
+  static const int kMaxInnerFunctionEntries = 256;
+  void RecordInnerFunctions(int start_position, Vector<const unsigned> entries);
+  void TakeInnerFunctions(Isolate* isolate, Handle<Script> script,
+                          int start_position);
+  void PublishInnerFunctions(Isolate* isolate, Handle<Script> script);
 
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters, bool* ok);
@@ -1198,8 +1214,31 @@ class Parser : public ParserBase<ParserTraits> {
   // parsing.
   int use_counts_[v8::Isolate::kUseCounterFeatureCount];
   int total_preparse_skipped_;
+  int total_preparsed_functions_;
   HistogramTimer* pre_parse_timer_;
 
+  // Fully parse and eagerly compile functions that would otherwise be
+  // preparsed, so that their bodies are not reparsed on the main thread
+  // when they are first called.
+  bool eager_top_level_functions_;
+
+  struct InnerFunctions {
+    int start_position;
+    Vector<const unsigned> entries;
+  };
+  // Whether preparse data of inner functions is taken from and recorded for
+  // the script. Only the first compilation of a function does so; reparsing
+  // for optimization or debugging leaves the data alone.
+  bool record_inner_functions_;
+  // Whether a direct eval call has been seen, including one in a lazily
+  // parsed function body. Recorded on the script, see Script::calls_eval.
+  bool calls_eval_;
+  // Function entries of the functions nested in the function being compiled,
+  // sorted by start position.
+  Vector<const unsigned> inner_function_entries_;
+  // Inner functions of skipped function bodies, to be stored on the script.
+  List<InnerFunctions> recorded_inner_functions_;
+
   bool parsing_on_main_thread_;
 };
 
@@ -193,6 +193,12 @@ class CompleteParserRecorder : public ParserRecorder {
     DCHECK(HasError());
     return function_store_.ToVector();
   }
+  // The function entries in the order in which the functions were completed.
+  // The caller owns the returned vector.
+  Vector<unsigned> FunctionEntries() {
+    DCHECK(!HasError());
+    return function_store_.ToVector();
+  }
 
  private:
   void WriteString(Vector<const char> str);
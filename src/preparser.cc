@@ -103,8 +103,9 @@ PreParserExpression PreParserTraits::ParseFunctionLiteral(
 
 PreParser::PreParseResult PreParser::PreParseLazyFunction(
     LanguageMode language_mode, FunctionKind kind, ParserRecorder* log,
-    Scanner::BookmarkScope* bookmark) {
+    Scanner::BookmarkScope* bookmark, ParserRecorder* inner_function_log) {
   log_ = log;
+  inner_function_log_ = inner_function_log;
   // Lazy functions always have trivial outer scopes (no with/catch scopes).
   Scope* top_scope = NewScope(scope_, SCRIPT_SCOPE);
   PreParserFactory top_factory(NULL);
@@ -1076,7 +1077,17 @@ PreParser::Expression PreParser::ParseFunctionLiteral(
   if (is_lazily_parsed) {
     ParseLazyFunctionLiteralBody(CHECK_OK);
   } else {
+    int body_start = position();
     ParseStatementList(Token::RBRACE, CHECK_OK);
+    if (inner_function_log_ != NULL) {
+      // Position right after terminal '}'.
+      int body_end = scanner()->peek_location().end_pos;
+      inner_function_log_->LogFunction(
+          body_start, body_end, function_state.materialized_literal_count(),
+          function_state.expected_property_count(),
+          function_scope->language_mode(),
+          function_scope->uses_super_property(), function_scope->calls_eval());
+    }
   }
   Expect(Token::RBRACE, CHECK_OK);
 
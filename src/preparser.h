@@ -1704,7 +1704,8 @@ class PreParser : public ParserBase<PreParserTraits> {
   PreParser(Zone* zone, Scanner* scanner, AstValueFactory* ast_value_factory,
             ParserRecorder* log, uintptr_t stack_limit)
       : ParserBase<PreParserTraits>(zone, scanner, stack_limit, NULL,
-                                    ast_value_factory, log, this) {}
+                                    ast_value_factory, log, this),
+        inner_function_log_(NULL) {}
 
   // Pre-parse the program from the character stream; returns true on
   // success (even if parsing failed, the pre-parse data successfully
@@ -1739,15 +1740,20 @@ class PreParser : public ParserBase<PreParserTraits> {
   // keyword and parameters, and have consumed the initial '{'.
   // At return, unless an error occurred, the scanner is positioned before the
   // the final '}'.
+  // If inner_function_log is given, the functions nested in the body are
+  // logged to it as well.
   PreParseResult PreParseLazyFunction(
       LanguageMode language_mode, FunctionKind kind, ParserRecorder* log,
-      Scanner::BookmarkScope* bookmark = nullptr);
+      Scanner::BookmarkScope* bookmark = nullptr,
+      ParserRecorder* inner_function_log = nullptr);
 
  private:
   friend class PreParserTraits;
 
   static const int kLazyParseTrialLimit = 200;
 
+  ParserRecorder* inner_function_log_;
+
   // These types form an algebra over syntactic categories that is just
   // rich enough to let us recognize and propagate the constructs that
   // are either being counted in the preparser data, or is important
@@ -165,14 +165,12 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
 
   if (parse_result.simple &&
       !flags.is_ignore_case() &&
-      !flags.is_sticky() &&
       !HasFewDifferentCharacters(pattern)) {
     // Parse-tree is a single atom that is equal to the pattern.
     AtomCompile(re, pattern, flags, pattern);
     has_been_compiled = true;
   } else if (parse_result.tree->IsAtom() &&
       !flags.is_ignore_case() &&
-      !flags.is_sticky() &&
       parse_result.capture_count == 0) {
     RegExpAtom* atom = parse_result.tree->AsAtom();
     Vector<const uc16> atom_pattern = atom->data();
@@ -244,6 +242,22 @@ static void SetAtomLastCapture(FixedArray* array,
 }
 
 
+// Finds the first occurrence of |pattern| in |subject| at or after |index|.
+// A sticky atom only matches at exactly |index|.
+template <typename SubjectChar, typename PatternChar>
+static int AtomSearch(Isolate* isolate, Vector<const SubjectChar> subject,
+                      Vector<const PatternChar> pattern, int index,
+                      bool sticky) {
+  if (!sticky) return SearchString(isolate, subject, pattern, index);
+  if (index + pattern.length() > subject.length()) return -1;
+  if (CompareChars(subject.start() + index, pattern.start(),
+                   pattern.length()) != 0) {
+    return -1;
+  }
+  return index;
+}
+
+
 int RegExpImpl::AtomExecRaw(Handle<JSRegExp> regexp,
                             Handle<String> subject,
                             int index,
@@ -266,6 +280,7 @@ int RegExpImpl::AtomExecRaw(Handle<JSRegExp> regexp,
     return RegExpImpl::RE_FAILURE;
   }
 
+  bool sticky = regexp->GetFlags().is_sticky();
   for (int i = 0; i < output_size; i += 2) {
     String::FlatContent needle_content = needle->GetFlatContent();
     String::FlatContent subject_content = subject->GetFlatContent();
@@ -275,15 +290,18 @@ int RegExpImpl::AtomExecRaw(Handle<JSRegExp> regexp,
     index =
         (needle_content.IsOneByte()
              ? (subject_content.IsOneByte()
-                    ? SearchString(isolate, subject_content.ToOneByteVector(),
-                                   needle_content.ToOneByteVector(), index)
-                    : SearchString(isolate, subject_content.ToUC16Vector(),
-                                   needle_content.ToOneByteVector(), index))
+                    ? AtomSearch(isolate, subject_content.ToOneByteVector(),
+                                 needle_content.ToOneByteVector(), index,
+                                 sticky)
+                    : AtomSearch(isolate, subject_content.ToUC16Vector(),
+                                 needle_content.ToOneByteVector(), index,
+                                 sticky))
              : (subject_content.IsOneByte()
-                    ? SearchString(isolate, subject_content.ToOneByteVector(),
-                                   needle_content.ToUC16Vector(), index)
-                    : SearchString(isolate, subject_content.ToUC16Vector(),
-                                   needle_content.ToUC16Vector(), index)));
+                    ? AtomSearch(isolate, subject_content.ToOneByteVector(),
+                                 needle_content.ToUC16Vector(), index, sticky)
+                    : AtomSearch(isolate, subject_content.ToUC16Vector(),
+                                 needle_content.ToUC16Vector(), index,
+                                 sticky)));
     if (index == -1) {
       return i / 2;  // Return number of matches.
     } else {
@@ -333,6 +351,12 @@ bool RegExpImpl::EnsureCompiledIrregexp(Handle<JSRegExp> re,
 #ifdef V8_INTERPRETED_REGEXP
   if (compiled_code->IsByteArray()) return true;
 #else  // V8_INTERPRETED_REGEXP (RegExp native code)
+  if (IrregexpIsInterpreted(FixedArray::cast(re->data()))) {
+    // Regexps which are not hot yet only get bytecode.
+    Object* bytecode = re->DataAt(JSRegExp::bytecode_index(is_one_byte));
+    if (bytecode->IsByteArray()) return true;
+    return CompileIrregexp(re, sample_subject, is_one_byte);
+  }
   if (compiled_code->IsCode()) return true;
 #endif
   // We could potentially have marked this as flushable, but have kept
@@ -391,10 +415,11 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     USE(ThrowRegExpException(re, pattern, compile_data.error));
     return false;
   }
+  bool interpreted = IrregexpIsInterpreted(FixedArray::cast(re->data()));
   RegExpEngine::CompilationResult result = RegExpEngine::Compile(
       isolate, &zone, &compile_data, flags.is_ignore_case(), flags.is_global(),
       flags.is_multiline(), flags.is_sticky(), pattern, sample_subject,
-      is_one_byte);
+      is_one_byte, interpreted);
   if (result.error_message != NULL) {
     // Unable to compile regexp.
     Handle<String> error_message = isolate->factory()->NewStringFromUtf8(
@@ -404,7 +429,11 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
   }
 
   Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
-  data->set(JSRegExp::code_index(is_one_byte), result.code);
+  int index = JSRegExp::code_index(is_one_byte);
+#ifndef V8_INTERPRETED_REGEXP
+  if (interpreted) index = JSRegExp::bytecode_index(is_one_byte);
+#endif
+  data->set(index, result.code);
   int register_max = IrregexpMaxRegisterCount(*data);
   if (result.num_registers > register_max) {
     SetIrregexpMaxRegisterCount(*data, result.num_registers);
@@ -436,7 +465,11 @@ int RegExpImpl::IrregexpNumberOfRegisters(FixedArray* re) {
 
 
 ByteArray* RegExpImpl::IrregexpByteCode(FixedArray* re, bool is_one_byte) {
+#ifdef V8_INTERPRETED_REGEXP
   return ByteArray::cast(re->get(JSRegExp::code_index(is_one_byte)));
+#else
+  return ByteArray::cast(re->get(JSRegExp::bytecode_index(is_one_byte)));
+#endif
 }
 
 
@@ -445,6 +478,40 @@ Code* RegExpImpl::IrregexpNativeCode(FixedArray* re, bool is_one_byte) {
 }
 
 
+bool RegExpImpl::IrregexpIsInterpreted(FixedArray* re) {
+#ifdef V8_INTERPRETED_REGEXP
+  return true;
+#else
+  int ticks = Smi::cast(re->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))
+                  ->value();
+  return ticks != JSRegExp::kTieredUpValue;
+#endif
+}
+
+
+void RegExpImpl::IrregexpTickTierUp(Handle<JSRegExp> re) {
+  FixedArray* data = FixedArray::cast(re->data());
+  int ticks =
+      Smi::cast(data->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))->value();
+  if (ticks == JSRegExp::kTieredUpValue) return;
+  if (ticks > 0) {
+    data->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+              Smi::FromInt(ticks - 1));
+    return;
+  }
+  // The regexp is hot. Native code is compiled on demand for each subject
+  // encoding, so the bytecode is no longer needed.
+  if (FLAG_trace_regexp_tier_up) {
+    PrintF("[tiering up regexp /%s/]\n", re->Pattern()->ToCString().get());
+  }
+  Smi* uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  data->set(JSRegExp::kIrregexpLatin1BytecodeIndex, uninitialized);
+  data->set(JSRegExp::kIrregexpUC16BytecodeIndex, uninitialized);
+  data->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+            Smi::FromInt(JSRegExp::kTieredUpValue));
+}
+
+
 void RegExpImpl::IrregexpInitialize(Handle<JSRegExp> re,
                                     Handle<String> pattern,
                                     JSRegExp::Flags flags,
@@ -462,22 +529,26 @@ int RegExpImpl::IrregexpPrepare(Handle<JSRegExp> regexp,
                                 Handle<String> subject) {
   subject = String::Flatten(subject);
 
+#ifndef V8_INTERPRETED_REGEXP
+  IrregexpTickTierUp(regexp);
+#endif  // V8_INTERPRETED_REGEXP
+
   // Check representation of the underlying storage.
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
   if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte)) return -1;
 
-#ifdef V8_INTERPRETED_REGEXP
-  // Byte-code regexp needs space allocated for all its registers.
-  // The result captures are copied to the start of the registers array
-  // if the match succeeds.  This way those registers are not clobbered
-  // when we set the last match info from last successful match.
-  return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
-         (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#else  // V8_INTERPRETED_REGEXP
+  FixedArray* data = FixedArray::cast(regexp->data());
+  if (IrregexpIsInterpreted(data)) {
+    // Byte-code regexp needs space allocated for all its registers.
+    // The result captures are copied to the start of the registers array
+    // if the match succeeds.  This way those registers are not clobbered
+    // when we set the last match info from last successful match.
+    return IrregexpNumberOfRegisters(data) +
+           (IrregexpNumberOfCaptures(data) + 1) * 2;
+  }
   // Native regexp only needs room to output captures. Registers are handled
   // internally.
-  return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#endif  // V8_INTERPRETED_REGEXP
+  return (IrregexpNumberOfCaptures(data) + 1) * 2;
 }
 
 
@@ -497,45 +568,52 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
 
 #ifndef V8_INTERPRETED_REGEXP
-  DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
-  do {
-    EnsureCompiledIrregexp(regexp, subject, is_one_byte);
-    Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
-    // The stack is used to allocate registers for the compiled regexp code.
-    // This means that in case of failure, the output registers array is left
-    // untouched and contains the capture results from the previous successful
-    // match.  We can use that to set the last match info lazily.
-    NativeRegExpMacroAssembler::Result res =
-        NativeRegExpMacroAssembler::Match(code,
-                                          subject,
-                                          output,
-                                          output_size,
-                                          index,
-                                          isolate);
-    if (res != NativeRegExpMacroAssembler::RETRY) {
-      DCHECK(res != NativeRegExpMacroAssembler::EXCEPTION ||
-             isolate->has_pending_exception());
-      STATIC_ASSERT(
-          static_cast<int>(NativeRegExpMacroAssembler::SUCCESS) == RE_SUCCESS);
-      STATIC_ASSERT(
-          static_cast<int>(NativeRegExpMacroAssembler::FAILURE) == RE_FAILURE);
-      STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::EXCEPTION)
-                    == RE_EXCEPTION);
-      return static_cast<IrregexpResult>(res);
-    }
-    // If result is RETRY, the string has changed representation, and we
-    // must restart from scratch.
-    // In this case, it means we must make sure we are prepared to handle
-    // the, potentially, different subject (the string can switch between
-    // being internal and external, and even between being Latin1 and UC16,
-    // but the characters are always the same).
-    IrregexpPrepare(regexp, subject);
-    is_one_byte = subject->IsOneByteRepresentationUnderneath();
-  } while (true);
-  UNREACHABLE();
-  return RE_EXCEPTION;
-#else  // V8_INTERPRETED_REGEXP
+  if (!IrregexpIsInterpreted(*irregexp)) {
+    DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
+    do {
+      EnsureCompiledIrregexp(regexp, subject, is_one_byte);
+      Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
+      // The stack is used to allocate registers for the compiled regexp
+      // code. This means that in case of failure, the output registers array
+      // is left untouched and contains the capture results from the previous
+      // successful match.  We can use that to set the last match info lazily.
+      NativeRegExpMacroAssembler::Result res =
+          NativeRegExpMacroAssembler::Match(code,
+                                            subject,
+                                            output,
+                                            output_size,
+                                            index,
+                                            isolate);
+      if (res != NativeRegExpMacroAssembler::RETRY) {
+        DCHECK(res != NativeRegExpMacroAssembler::EXCEPTION ||
+               isolate->has_pending_exception());
+        STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::SUCCESS) ==
+                      RE_SUCCESS);
+        STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::FAILURE) ==
+                      RE_FAILURE);
+        STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::EXCEPTION) ==
+                      RE_EXCEPTION);
+        return static_cast<IrregexpResult>(res);
+      }
+      // If result is RETRY, the string has changed representation, and we
+      // must restart from scratch.
+      // In this case, it means we must make sure we are prepared to handle
+      // the, potentially, different subject (the string can switch between
+      // being internal and external, and even between being Latin1 and UC16,
+      // but the characters are always the same).
+      IrregexpPrepare(regexp, subject);
+      is_one_byte = subject->IsOneByteRepresentationUnderneath();
+    } while (true);
+    UNREACHABLE();
+    return RE_EXCEPTION;
+  }
+#endif  // V8_INTERPRETED_REGEXP
 
+  // The subject may have changed its representation since the regexp was
+  // prepared.
+  if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte)) {
+    return RE_EXCEPTION;
+  }
   DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
   // registers.
@@ -565,7 +643,6 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
     isolate->StackOverflow();
   }
   return result;
-#endif  // V8_INTERPRETED_REGEXP
 }
 
 
@@ -654,23 +731,20 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
     register_array_size_(0),
     regexp_(regexp),
     subject_(subject) {
-#ifdef V8_INTERPRETED_REGEXP
-  bool interpreted = true;
-#else
+  // There is no distinction between interpreted and native for atom regexps.
   bool interpreted = false;
-#endif  // V8_INTERPRETED_REGEXP
 
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
     registers_per_match_ = kAtomRegistersPerMatch;
-    // There is no distinction between interpreted and native for atom regexps.
-    interpreted = false;
   } else {
     registers_per_match_ = RegExpImpl::IrregexpPrepare(regexp_, subject_);
     if (registers_per_match_ < 0) {
       num_matches_ = -1;  // Signal exception.
       return;
     }
+    interpreted =
+        RegExpImpl::IrregexpIsInterpreted(FixedArray::cast(regexp_->data()));
   }
 
   if (is_global && !interpreted) {
@@ -1105,7 +1179,7 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
   heap->IncreaseTotalRegexpCodeGenerated(code->Size());
   work_list_ = NULL;
 #ifdef ENABLE_DISASSEMBLER
-  if (FLAG_print_code) {
+  if (FLAG_print_code && code->IsCode()) {
     CodeTracer::Scope trace_scope(heap->isolate()->GetCodeTracer());
     OFStream os(trace_scope.file());
     Handle<Code>::cast(code)->Disassemble(pattern->ToCString().get(), os);
@@ -3794,12 +3868,44 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
       min_lookahead, max_lookahead, boolean_skip_table);
   DCHECK(skip_distance != 0);
 
+  // The skip table is the union of the characters over the whole interval.
+  // For alternations of literals like /error|warn|fatal/ this union is much
+  // larger than the set of characters at any one position, so a character
+  // from the union that cannot occur at max_lookahead still rules out a match
+  // at the current position.  In that case we step forwards by one without
+  // leaving the skip loop.
+  Handle<ByteArray> last_position_table;
+  if (skip_distance > 1) {
+    int union_count = 0;
+    for (int i = 0; i < kSize; i++) {
+      if (boolean_skip_table->get(i) != 0) union_count++;
+    }
+    BoyerMoorePositionInfo* map = bitmaps_->at(max_lookahead);
+    if (map->map_count() < union_count) {
+      last_position_table = factory->NewByteArray(kSize, TENURED);
+      for (int i = 0; i < kSize; i++) {
+        last_position_table->set(i, map->at(i) ? 1 : 0);
+      }
+    }
+  }
+
   Label cont, again;
   masm->Bind(&again);
   masm->LoadCurrentCharacter(max_lookahead, &cont, true);
-  masm->CheckBitInTable(boolean_skip_table, &cont);
-  masm->AdvanceCurrentPosition(skip_distance);
-  masm->GoTo(&again);
+  if (last_position_table.is_null()) {
+    masm->CheckBitInTable(boolean_skip_table, &cont);
+    masm->AdvanceCurrentPosition(skip_distance);
+    masm->GoTo(&again);
+  } else {
+    Label in_interval;
+    masm->CheckBitInTable(boolean_skip_table, &in_interval);
+    masm->AdvanceCurrentPosition(skip_distance);
+    masm->GoTo(&again);
+    masm->Bind(&in_interval);
+    masm->CheckBitInTable(last_position_table, &cont);
+    masm->AdvanceCurrentPosition(1);
+    masm->GoTo(&again);
+  }
   masm->Bind(&cont);
 }
 
@@ -6257,7 +6363,7 @@ void DispatchTableConstructor::VisitAction(ActionNode* that) {
 RegExpEngine::CompilationResult RegExpEngine::Compile(
     Isolate* isolate, Zone* zone, RegExpCompileData* data, bool ignore_case,
     bool is_global, bool is_multiline, bool is_sticky, Handle<String> pattern,
-    Handle<String> sample_subject, bool is_one_byte) {
+    Handle<String> sample_subject, bool is_one_byte, bool interpreted) {
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     return IrregexpRegExpTooBig(isolate);
   }
@@ -6329,49 +6435,55 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     return CompilationResult(isolate, error_message);
   }
 
-  // Create the correct assembler for the architecture.
+  // Create the correct assembler for the architecture. The bytecode
+  // assembler emits into |codes|.
+  EmbeddedVector<byte, 1024> codes;
+  base::SmartPointer<RegExpMacroAssembler> macro_assembler;
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
-
-  NativeRegExpMacroAssembler::Mode mode =
-      is_one_byte ? NativeRegExpMacroAssembler::LATIN1
-                  : NativeRegExpMacroAssembler::UC16;
+  if (!interpreted) {
+    // Native regexp implementation.
+    NativeRegExpMacroAssembler::Mode mode =
+        is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                    : NativeRegExpMacroAssembler::UC16;
+    int output_registers = (data->capture_count + 1) * 2;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerIA32(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerX64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerARM(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(isolate, zone, mode,
-                                            (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerARM64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_PPC
-  RegExpMacroAssemblerPPC macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerPPC(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS64
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_X87
-  RegExpMacroAssemblerX87 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerX87(isolate, zone, mode, output_registers));
 #else
 #error "Unsupported architecture"
 #endif
+  }
+#endif  // V8_INTERPRETED_REGEXP
 
-#else  // V8_INTERPRETED_REGEXP
   // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(isolate, codes, zone);
-#endif  // V8_INTERPRETED_REGEXP
+  if (macro_assembler.is_empty()) {
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
+  }
 
-  macro_assembler.set_slow_safe(TooMuchRegExpCode(pattern));
+  macro_assembler->set_slow_safe(TooMuchRegExpCode(pattern));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
@@ -6379,17 +6491,17 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
   if (is_end_anchored &&
       !is_start_anchored &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
-    macro_assembler.set_global_mode(
+    macro_assembler->set_global_mode(
         (data->tree->min_match() > 0)
             ? RegExpMacroAssembler::GLOBAL_NO_ZERO_LENGTH_CHECK
             : RegExpMacroAssembler::GLOBAL);
   }
 
-  return compiler.Assemble(&macro_assembler,
+  return compiler.Assemble(macro_assembler.get(),
                            node,
                            data->capture_count,
                            pattern);
@@ -204,6 +204,9 @@ class RegExpImpl {
   static int IrregexpNumberOfRegisters(FixedArray* re);
   static ByteArray* IrregexpByteCode(FixedArray* re, bool is_one_byte);
   static Code* IrregexpNativeCode(FixedArray* re, bool is_one_byte);
+  // Whether the regexp currently runs in the bytecode interpreter, see
+  // --regexp-tier-up.
+  static bool IrregexpIsInterpreted(FixedArray* re);
 
   // Limit the space regexps take up on the heap.  In order to limit this we
   // would like to keep track of the amount of regexp code on the heap.  This
@@ -217,6 +220,9 @@ class RegExpImpl {
  private:
   static bool CompileIrregexp(Handle<JSRegExp> re,
                               Handle<String> sample_subject, bool is_one_byte);
+  // Counts an execution of a regexp running in the interpreter and switches
+  // it to native code once it has used up its tier-up ticks.
+  static void IrregexpTickTierUp(Handle<JSRegExp> re);
   static inline bool EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
                                             bool is_one_byte);
@@ -1646,12 +1652,14 @@ class RegExpEngine: public AllStatic {
     int num_registers;
   };
 
+  // Generates native code, or bytecode for the regexp interpreter if
+  // |interpreted| is set or native regexps are not supported.
   static CompilationResult Compile(Isolate* isolate, Zone* zone,
                                    RegExpCompileData* input, bool ignore_case,
                                    bool global, bool multiline, bool sticky,
                                    Handle<String> pattern,
                                    Handle<String> sample_subject,
-                                   bool is_one_byte);
+                                   bool is_one_byte, bool interpreted);
 
   static bool TooMuchRegExpCode(Handle<String> pattern);
 
@@ -1267,6 +1267,250 @@ RUNTIME_FUNCTION(Runtime_GetCachedArrayIndex) {
 }
 
 
+// Returns true if the holes in the fast backing store of {array} read as
+// undefined, because nothing on its prototype chain can supply an element.
+static bool HasInitialArrayPrototypeChain(Isolate* isolate, JSArray* array) {
+  DisallowHeapAllocation no_gc;
+  Object* prototype = array->map()->prototype();
+  return prototype->IsJSArray() &&
+         isolate->is_initial_array_prototype(JSArray::cast(prototype)) &&
+         isolate->IsFastArrayConstructorPrototypeChainIntact();
+}
+
+
+// Returns true if the fast backing store of {array} can be written directly
+// instead of going through the generic element stores.
+static bool CanWriteFastElementsDirectly(Isolate* isolate, JSArray* array) {
+  DisallowHeapAllocation no_gc;
+  Map* map = array->map();
+  return IsFastElementsKind(map->elements_kind()) && !map->is_observed() &&
+         map->is_extensible() && array->length()->IsSmi() &&
+         HasInitialArrayPrototypeChain(isolate, array);
+}
+
+
+// Scans the fast backing store of {array} for an element equal to {search}
+// in [from, to), in reverse order if {reverse} is set. Elements are compared
+// with strict equality, or with SameValueZero if {same_value_zero} is set, in
+// which case NaN is found and holes read as undefined. Returns the index, -1
+// if there is none, or undefined if the elements cannot be scanned directly
+// and the caller has to take the generic path.
+static Object* FastArrayIndexOf(Isolate* isolate, Object* receiver,
+                                Object* search, double from, double to,
+                                bool reverse, bool same_value_zero) {
+  DisallowHeapAllocation no_gc;
+  Heap* heap = isolate->heap();
+  if (!receiver->IsJSArray()) return heap->undefined_value();
+  JSArray* array = JSArray::cast(receiver);
+  // Holes can be skipped only if nothing on the prototype chain can supply
+  // an element for them.
+  if (!HasInitialArrayPrototypeChain(isolate, array)) {
+    return heap->undefined_value();
+  }
+  // SIMD values compare by value.
+  if (search->IsSimd128Value()) return heap->undefined_value();
+
+  ElementsKind kind = array->GetElementsKind();
+  if (!IsFastElementsKind(kind)) return heap->undefined_value();
+  FixedArrayBase* elements = array->elements();
+  double capacity = elements->length();
+  int start = static_cast<int>(Max(0.0, Min(from, capacity)));
+  int end = static_cast<int>(Max(0.0, Min(to, capacity)));
+  int step = 1;
+  if (reverse) {
+    int last = end - 1;
+    end = start - 1;
+    start = last;
+    step = -1;
+  }
+  Smi* not_found = Smi::FromInt(-1);
+  bool find_holes = same_value_zero && search->IsUndefined();
+  bool find_nan =
+      same_value_zero && search->IsNumber() && std::isnan(search->Number());
+
+  if (IsFastDoubleElementsKind(kind)) {
+    FixedDoubleArray* doubles = FixedDoubleArray::cast(elements);
+    if (find_holes) {
+      for (int i = start; i != end; i += step) {
+        if (doubles->is_the_hole(i)) return Smi::FromInt(i);
+      }
+      return not_found;
+    }
+    if (!search->IsNumber()) return not_found;
+    double search_value = search->Number();
+    for (int i = start; i != end; i += step) {
+      if (doubles->is_the_hole(i)) continue;
+      double element = doubles->get_scalar(i);
+      if (element == search_value || (find_nan && std::isnan(element))) {
+        return Smi::FromInt(i);
+      }
+    }
+    return not_found;
+  }
+
+  FixedArray* objects = FixedArray::cast(elements);
+  if (find_holes) {
+    for (int i = start; i != end; i += step) {
+      Object* element = objects->get(i);
+      if (element->IsTheHole() || element->IsUndefined()) {
+        return Smi::FromInt(i);
+      }
+    }
+    return not_found;
+  }
+
+  if (IsFastSmiElementsKind(kind)) {
+    int32_t search_value;
+    if (!search->IsNumber() || !search->ToInt32(&search_value) ||
+        !Smi::IsValid(search_value)) {
+      return not_found;
+    }
+    Object* search_smi = Smi::FromInt(search_value);
+    for (int i = start; i != end; i += step) {
+      if (objects->get(i) == search_smi) return Smi::FromInt(i);
+    }
+    return not_found;
+  }
+
+  if (search->IsNumber()) {
+    double search_value = search->Number();
+    for (int i = start; i != end; i += step) {
+      Object* element = objects->get(i);
+      if (!element->IsNumber()) continue;
+      double element_value = element->Number();
+      if (element_value == search_value ||
+          (find_nan && std::isnan(element_value))) {
+        return Smi::FromInt(i);
+      }
+    }
+  } else if (search->IsString()) {
+    String* search_string = String::cast(search);
+    for (int i = start; i != end; i += step) {
+      Object* element = objects->get(i);
+      if (element->IsString() && search_string->Equals(String::cast(element))) {
+        return Smi::FromInt(i);
+      }
+    }
+  } else {
+    DCHECK(!search->IsTheHole());
+    for (int i = start; i != end; i += step) {
+      if (objects->get(i) == search) return Smi::FromInt(i);
+    }
+  }
+  return not_found;
+}
+
+
+RUNTIME_FUNCTION(Runtime_FastArrayIndexOf) {
+  SealHandleScope shs(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_DOUBLE_ARG_CHECKED(from, 2);
+  CONVERT_DOUBLE_ARG_CHECKED(to, 3);
+  return FastArrayIndexOf(isolate, args[0], args[1], from, to, false, false);
+}
+
+
+RUNTIME_FUNCTION(Runtime_FastArrayLastIndexOf) {
+  SealHandleScope shs(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_DOUBLE_ARG_CHECKED(from, 2);
+  CONVERT_DOUBLE_ARG_CHECKED(to, 3);
+  return FastArrayIndexOf(isolate, args[0], args[1], from, to, true, false);
+}
+
+
+RUNTIME_FUNCTION(Runtime_FastArrayIncludes) {
+  SealHandleScope shs(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_DOUBLE_ARG_CHECKED(from, 2);
+  CONVERT_DOUBLE_ARG_CHECKED(to, 3);
+  Object* result =
+      FastArrayIndexOf(isolate, args[0], args[1], from, to, false, true);
+  if (!result->IsSmi()) return result;
+  return isolate->heap()->ToBoolean(Smi::cast(result)->value() >= 0);
+}
+
+
+// Stores {value} into [from, to) of the fast backing store of {array}, as
+// Array.prototype.fill does. Returns the array, or undefined if the value
+// does not fit the elements kind or the elements cannot be written directly.
+RUNTIME_FUNCTION(Runtime_FastArrayFill) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_ARG_HANDLE_CHECKED(Object, receiver, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, value, 1);
+  CONVERT_DOUBLE_ARG_CHECKED(from, 2);
+  CONVERT_DOUBLE_ARG_CHECKED(to, 3);
+  if (!receiver->IsJSArray() ||
+      !CanWriteFastElementsDirectly(isolate, JSArray::cast(*receiver))) {
+    return isolate->heap()->undefined_value();
+  }
+  Handle<JSArray> array = Handle<JSArray>::cast(receiver);
+  ElementsKind kind = array->GetElementsKind();
+  if ((IsFastSmiElementsKind(kind) && !value->IsSmi()) ||
+      (IsFastDoubleElementsKind(kind) && !value->IsNumber())) {
+    return isolate->heap()->undefined_value();
+  }
+
+  double length = Smi::cast(array->length())->value();
+  int start = static_cast<int>(Max(0.0, Min(from, length)));
+  int end = static_cast<int>(Max(0.0, Min(to, length)));
+  if (start >= end) return *array;
+
+  if (IsFastDoubleElementsKind(kind)) {
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    double number = value->Number();
+    for (int i = start; i < end; i++) elements->set(i, number);
+  } else {
+    JSObject::EnsureWritableFastElements(array);
+    DisallowHeapAllocation no_gc;
+    FixedArray* elements = FixedArray::cast(array->elements());
+    WriteBarrierMode mode = elements->GetWriteBarrierMode(no_gc);
+    for (int i = start; i < end; i++) elements->set(i, *value, mode);
+  }
+  return *array;
+}
+
+
+// Reverses the fast backing store of {array} in place, holes included, as
+// Array.prototype.reverse does. Returns the array, or undefined if the
+// elements cannot be written directly.
+RUNTIME_FUNCTION(Runtime_FastArrayReverse) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_HANDLE_CHECKED(Object, receiver, 0);
+  if (!receiver->IsJSArray() ||
+      !CanWriteFastElementsDirectly(isolate, JSArray::cast(*receiver))) {
+    return isolate->heap()->undefined_value();
+  }
+  Handle<JSArray> array = Handle<JSArray>::cast(receiver);
+  int length = Smi::cast(array->length())->value();
+  if (length < 2) return *array;
+
+  if (array->HasFastDoubleElements()) {
+    // Move the raw bits so that holes stay holes.
+    uint64_t* data = reinterpret_cast<uint64_t*>(
+        FixedDoubleArray::cast(array->elements())->data_start());
+    for (int i = 0, j = length - 1; i < j; i++, j--) {
+      uint64_t element = data[i];
+      data[i] = data[j];
+      data[j] = element;
+    }
+  } else {
+    JSObject::EnsureWritableFastElements(array);
+    DisallowHeapAllocation no_gc;
+    FixedArray* elements = FixedArray::cast(array->elements());
+    WriteBarrierMode mode = elements->GetWriteBarrierMode(no_gc);
+    for (int i = 0, j = length - 1; i < j; i++, j--) {
+      Object* element = elements->get(i);
+      elements->set(i, elements->get(j), mode);
+      elements->set(j, element, mode);
+    }
+  }
+  return *array;
+}
+
+
 RUNTIME_FUNCTION(Runtime_FastOneByteArrayJoin) {
   SealHandleScope shs(isolate);
   DCHECK(args.length() == 2);
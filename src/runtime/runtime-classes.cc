@@ -287,8 +287,9 @@ RUNTIME_FUNCTION(Runtime_ClassGetSourceCode) {
       JSReceiver::GetDataProperty(fun, end_position_symbol);
   CHECK(end_position->IsSmi());
 
-  Handle<String> source(
-      String::cast(Script::cast(fun->shared()->script())->source()));
+  Handle<Script> script(Script::cast(fun->shared()->script()), isolate);
+  Script::EnsureSource(script);
+  Handle<String> source(String::cast(script->source()), isolate);
   return *isolate->factory()->NewSubString(
       source, Handle<Smi>::cast(start_position)->value(),
       Handle<Smi>::cast(end_position)->value());
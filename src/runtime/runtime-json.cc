@@ -43,9 +43,11 @@ RUNTIME_FUNCTION(Runtime_ParseJson) {
 
   source = String::Flatten(source);
   // Optimized fast case where we only have Latin1 characters.
+  bool one_byte =
+      source->IsSeqOneByteString() || source->IsExternalOneByteString();
   Handle<Object> result;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, result,
-                                     source->IsSeqOneByteString()
+                                     one_byte
                                          ? JsonParser<true>::Parse(source)
                                          : JsonParser<false>::Parse(source));
   return *result;
@@ -465,6 +465,96 @@ MUST_USE_RESULT static Object* StringReplaceGlobalAtomRegExpWithString(
 }
 
 
+// Global replacement with a string that contains no substitution patterns.
+// The match positions are collected in the zone while the native regexp runs
+// in batches, so that the result can be written into a single sequential
+// string of the exact length without building an array of parts first.
+template <typename ResultSeqString>
+MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithSimpleString(
+    Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
+    Handle<String> replacement, Handle<JSArray> last_match_info, Zone* zone) {
+  DCHECK(subject->IsFlat());
+  DCHECK(replacement->IsFlat());
+
+  RegExpImpl::GlobalCache global_cache(regexp, subject, true, isolate);
+  if (global_cache.HasException()) return isolate->heap()->exception();
+
+  // Start and end positions of the matches, in pairs.
+  ZoneList<int> indices(8, zone);
+  int64_t matched_length = 0;
+  int32_t* current_match = global_cache.FetchNext();
+  while (current_match != NULL) {
+    indices.Add(current_match[0], zone);
+    indices.Add(current_match[1], zone);
+    matched_length += current_match[1] - current_match[0];
+    current_match = global_cache.FetchNext();
+  }
+  if (global_cache.HasException()) return isolate->heap()->exception();
+
+  int matches = indices.length() / 2;
+  if (matches == 0) return *subject;
+
+  int subject_len = subject->length();
+  int replacement_len = replacement->length();
+
+  // Detect integer overflow.
+  int64_t result_len_64 =
+      static_cast<int64_t>(replacement_len) * static_cast<int64_t>(matches) +
+      static_cast<int64_t>(subject_len) - matched_length;
+  int result_len;
+  if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
+    STATIC_ASSERT(String::kMaxLength < kMaxInt);
+    result_len = kMaxInt;  // Provoke exception.
+  } else {
+    result_len = static_cast<int>(result_len_64);
+  }
+
+  RegExpImpl::SetLastMatchInfo(last_match_info, subject, regexp->CaptureCount(),
+                               global_cache.LastSuccessfulMatch());
+
+  MaybeHandle<SeqString> maybe_res;
+  if (ResultSeqString::kHasOneByteEncoding) {
+    maybe_res = isolate->factory()->NewRawOneByteString(result_len);
+  } else {
+    maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
+  }
+  Handle<SeqString> untyped_res;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, untyped_res, maybe_res);
+  Handle<ResultSeqString> result = Handle<ResultSeqString>::cast(untyped_res);
+
+  DisallowHeapAllocation no_gc;
+  int subject_pos = 0;
+  int result_pos = 0;
+  for (int i = 0; i < indices.length(); i += 2) {
+    int start = indices.at(i);
+    // Copy non-matched subject content.
+    if (subject_pos < start) {
+      String::WriteToFlat(*subject, result->GetChars() + result_pos,
+                          subject_pos, start);
+      result_pos += start - subject_pos;
+    }
+
+    // Replace match.
+    if (replacement_len > 0) {
+      String::WriteToFlat(*replacement, result->GetChars() + result_pos, 0,
+                          replacement_len);
+      result_pos += replacement_len;
+    }
+
+    subject_pos = indices.at(i + 1);
+  }
+  // Add remaining subject content at the end.
+  if (subject_pos < subject_len) {
+    String::WriteToFlat(*subject, result->GetChars() + result_pos, subject_pos,
+                        subject_len);
+    result_pos += subject_len - subject_pos;
+  }
+  DCHECK_EQ(result_len, result_pos);
+
+  return *result;
+}
+
+
 MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
     Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
     Handle<String> replacement, Handle<JSArray> last_match_info) {
@@ -480,8 +570,10 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
   bool simple_replace =
       compiled_replacement.Compile(replacement, capture_count, subject_length);
 
-  // Shortcut for simple non-regexp global replacements
-  if (regexp->TypeTag() == JSRegExp::ATOM && simple_replace) {
+  // Shortcut for simple non-regexp global replacements.  Sticky atoms only
+  // match at consecutive positions and go through the global cache instead.
+  if (regexp->TypeTag() == JSRegExp::ATOM && simple_replace &&
+      !regexp->GetFlags().is_sticky()) {
     if (subject->HasOnlyOneByteChars() && replacement->HasOnlyOneByteChars()) {
       return StringReplaceGlobalAtomRegExpWithString<SeqOneByteString>(
           isolate, subject, regexp, replacement, last_match_info);
@@ -491,6 +583,18 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
     }
   }
 
+  if (simple_replace) {
+    if (subject->HasOnlyOneByteChars() && replacement->HasOnlyOneByteChars()) {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqOneByteString>(
+          isolate, subject, regexp, replacement, last_match_info,
+          zone_scope.zone());
+    } else {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqTwoByteString>(
+          isolate, subject, regexp, replacement, last_match_info,
+          zone_scope.zone());
+    }
+  }
+
   RegExpImpl::GlobalCache global_cache(regexp, subject, true, isolate);
   if (global_cache.HasException()) return isolate->heap()->exception();
 
@@ -523,11 +627,7 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
       builder.AddSubjectSlice(prev, start);
     }
 
-    if (simple_replace) {
-      builder.AddString(replacement);
-    } else {
-      compiled_replacement.Apply(&builder, start, end, current_match);
-    }
+    compiled_replacement.Apply(&builder, start, end, current_match);
     prev = end;
 
     current_match = global_cache.FetchNext();
@@ -556,7 +656,7 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithEmptyString(
   DCHECK(subject->IsFlat());
 
   // Shortcut for simple non-regexp global replacements
-  if (regexp->TypeTag() == JSRegExp::ATOM) {
+  if (regexp->TypeTag() == JSRegExp::ATOM && !regexp->GetFlags().is_sticky()) {
     Handle<String> empty_string = isolate->factory()->empty_string();
     if (subject->IsOneByteRepresentation()) {
       return StringReplaceGlobalAtomRegExpWithString<SeqOneByteString>(
@@ -50,6 +50,11 @@ namespace internal {
   F(GetCachedArrayIndex, 1, 1)              \
   F(FixedArrayGet, 2, 1)                    \
   F(FixedArraySet, 3, 1)                    \
+  F(FastArrayIndexOf, 4, 1)                 \
+  F(FastArrayLastIndexOf, 4, 1)             \
+  F(FastArrayIncludes, 4, 1)                \
+  F(FastArrayFill, 4, 1)                    \
+  F(FastArrayReverse, 1, 1)                 \
   F(FastOneByteArrayJoin, 2, 1)
 
 
@@ -200,6 +200,20 @@ size_t Utf8ToUtf16CharacterStream::CopyChars(uint16_t* dest, size_t length,
   while (i < length - 1) {
     if (*src_pos == src_length) break;
     unibrow::uchar c = src[*src_pos];
+    if (c <= unibrow::Utf8::kMaxOneByteChar) {
+      // ASCII bytes map one-to-one onto UTF-16 code units, so find the end of
+      // the run a word at a time and widen it in one go.
+      size_t run = Min(length - 1 - i, src_length - *src_pos);
+      run = String::NonAsciiStart(reinterpret_cast<const char*>(src + *src_pos),
+                                  static_cast<int>(run));
+      if (run > 0) {
+        v8::internal::CopyChars<uint8_t, uint16_t>(dest + i, src + *src_pos,
+                                                   run);
+        *src_pos += run;
+        i += run;
+        continue;
+      }
+    }
     if (c <= unibrow::Utf8::kMaxOneByteChar) {
       *src_pos = *src_pos + 1;
     } else {
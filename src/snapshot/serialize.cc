@@ -312,6 +312,16 @@ ExternalReferenceTable::ExternalReferenceTable(Isolate* isolate) {
         Deoptimizer::CALCULATE_ENTRY_ADDRESS);
     Add(address, "lazy_deopt");
   }
+
+  // Embedder-provided external references come last, so that the indices of
+  // V8's own references do not depend on them.
+  intptr_t* api_external_references = isolate->api_external_references();
+  if (api_external_references != NULL) {
+    while (*api_external_references != 0) {
+      Add(reinterpret_cast<Address>(*api_external_references), "<embedder>");
+      api_external_references++;
+    }
+  }
 }
 
 
@@ -1919,9 +1929,10 @@ void Serializer::ObjectSerializer::Serialize() {
   DCHECK(!object_->IsFiller());
 
   if (object_->IsScript()) {
-    // Clear cached line ends.
+    // Clear cached line ends and preparse data.
     Object* undefined = serializer_->isolate()->heap()->undefined_value();
     Script::cast(object_)->set_line_ends(undefined);
+    Script::cast(object_)->set_preparse_data(undefined);
   }
 
   if (object_->IsExternalString()) {
@@ -2335,6 +2346,47 @@ ScriptData* CodeSerializer::Serialize(Isolate* isolate,
 }
 
 
+static void ResetForSerialization(SharedFunctionInfo* shared) {
+  shared->ClearOptimizedCodeMap();
+  if (shared->code()->kind() == Code::FUNCTION) {
+    shared->code()->ClearInlineCaches();
+  }
+  TypeFeedbackVector* vector = shared->feedback_vector();
+  shared->ClearTypeFeedbackInfo();
+  // Clearing keeps allocation sites alive, but those are linked into the
+  // isolate-wide list of allocation sites.
+  Object* uninitialized_sentinel =
+      TypeFeedbackVector::RawUninitializedSentinel(shared->GetHeap());
+  for (int i = 0; i < vector->Slots(); i++) {
+    FeedbackVectorSlot slot(i);
+    if (vector->Get(slot)->IsAllocationSite()) {
+      vector->Set(slot, uninitialized_sentinel);
+    }
+  }
+}
+
+
+ScriptData* CodeSerializer::SerializeCompiledScript(
+    Isolate* isolate, Handle<SharedFunctionInfo> info, Handle<String> source) {
+  Handle<Script> script(Script::cast(info->script()), isolate);
+  DCHECK(script->has_serializable_code());
+  // A discarded source is referred to by the serialized script like the
+  // source of a freshly compiled one.
+  if (!script->source()->IsString()) script->set_source(*source);
+  ResetForSerialization(*info);
+  if (script->shared_function_infos()->IsWeakFixedArray()) {
+    WeakFixedArray* array =
+        WeakFixedArray::cast(script->shared_function_infos());
+    for (int i = 0; i < array->Length(); i++) {
+      Object* obj = array->Get(i);
+      if (!obj->IsSharedFunctionInfo()) continue;
+      ResetForSerialization(SharedFunctionInfo::cast(obj));
+    }
+  }
+  return Serialize(isolate, info, source);
+}
+
+
 void CodeSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
                                      WhereToPoint where_to_point, int skip) {
   int root_index = root_index_map_.Lookup(obj);
@@ -2368,13 +2420,17 @@ void CodeSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
         SerializeIC(code_object, how_to_code, where_to_point);
         return;
       case Code::FUNCTION:
-        DCHECK(code_object->has_reloc_info_for_serialization());
         // Only serialize the code for the toplevel function unless specified
         // by flag. Replace code of inner functions by the lazy compile builtin.
-        // This is safe, as checked in Compiler::GetSharedFunctionInfo.
-        if (code_object != main_code_ && !FLAG_serialize_inner) {
+        // This is safe, as checked in Compiler::GetSharedFunctionInfo. Inner
+        // functions compiled lazily before their script was prepared for
+        // serialization lack the necessary reloc info and are dropped too.
+        if (code_object != main_code_ &&
+            (!FLAG_serialize_inner ||
+             !code_object->has_reloc_info_for_serialization())) {
           SerializeBuiltin(Builtins::kCompileLazy, how_to_code, where_to_point);
         } else {
+          DCHECK(code_object->has_reloc_info_for_serialization());
           SerializeGeneric(code_object, how_to_code, where_to_point);
         }
         return;
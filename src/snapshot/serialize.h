@@ -914,6 +914,14 @@ class CodeSerializer : public Serializer {
                                Handle<SharedFunctionInfo> info,
                                Handle<String> source);
 
+  // Serializes a script that may already have run, including the code of
+  // inner functions that have been compiled lazily since. Inline caches and
+  // type feedback of the script's functions are reset first, as they may
+  // refer to context-specific objects.
+  static ScriptData* SerializeCompiledScript(Isolate* isolate,
+                                             Handle<SharedFunctionInfo> info,
+                                             Handle<String> source);
+
   MUST_USE_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
       Isolate* isolate, ScriptData* cached_data, Handle<String> source);
 
@@ -20,6 +20,8 @@ namespace {
 
 v8::StartupData g_natives;
 v8::StartupData g_snapshot;
+base::OS::MemoryMappedFile* g_natives_file = nullptr;
+base::OS::MemoryMappedFile* g_snapshot_file = nullptr;
 
 
 void ClearStartupData(v8::StartupData* data) {
@@ -28,24 +30,42 @@ void ClearStartupData(v8::StartupData* data) {
 }
 
 
-void DeleteStartupData(v8::StartupData* data) {
-  delete[] data->data;
+void DeleteStartupData(v8::StartupData* data,
+                       base::OS::MemoryMappedFile** mapped_file) {
+  if (*mapped_file != nullptr) {
+    delete *mapped_file;
+    *mapped_file = nullptr;
+  } else {
+    delete[] data->data;
+  }
   ClearStartupData(data);
 }
 
 
 void FreeStartupData() {
-  DeleteStartupData(&g_natives);
-  DeleteStartupData(&g_snapshot);
+  DeleteStartupData(&g_natives, &g_natives_file);
+  DeleteStartupData(&g_snapshot, &g_snapshot_file);
 }
 
 
 void Load(const char* blob_file, v8::StartupData* startup_data,
+          base::OS::MemoryMappedFile** mapped_file,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   if (!blob_file) return;
 
+  // Map the blob read-only if possible, so that all processes loading it
+  // share the same physical pages instead of each keeping a private copy.
+  *mapped_file = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
+  if (*mapped_file != nullptr) {
+    startup_data->data = static_cast<const char*>((*mapped_file)->memory());
+    startup_data->raw_size = static_cast<int>((*mapped_file)->size());
+    (*setter_fn)(startup_data);
+    return;
+  }
+
   FILE* file = fopen(blob_file, "rb");
   if (!file) return;
 
@@ -63,8 +83,9 @@ void Load(const char* blob_file, v8::StartupData* startup_data,
 
 
 void LoadFromFiles(const char* natives_blob, const char* snapshot_blob) {
-  Load(natives_blob, &g_natives, v8::V8::SetNativesDataBlob);
-  Load(snapshot_blob, &g_snapshot, v8::V8::SetSnapshotDataBlob);
+  Load(natives_blob, &g_natives, &g_natives_file, v8::V8::SetNativesDataBlob);
+  Load(snapshot_blob, &g_snapshot, &g_snapshot_file,
+       v8::V8::SetSnapshotDataBlob);
 
   atexit(&FreeStartupData);
 }
@@ -330,6 +330,12 @@ class IncrementalStringBuilder {
       while (*u != '\0') Append(*(u++));
     }
 
+    template <typename SrcChar>
+    INLINE(void AppendChars(const SrcChar* chars, int length)) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
+
     int written() { return static_cast<int>(cursor_ - start_); }
 
    private:
@@ -5,6 +5,13 @@
 #ifndef V8_STRING_SEARCH_H_
 #define V8_STRING_SEARCH_H_
 
+#include "src/base/bits.h"
+
+#if V8_HOST_ARCH_X64 || (V8_HOST_ARCH_IA32 && defined(__SSE2__))
+#include <emmintrin.h>
+#define V8_STRING_SEARCH_SSE2 1
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -187,6 +194,99 @@ class StringSearch : private StringSearchBase {
 };
 
 
+//---------------------------------------------------------------------
+// Character comparison helpers
+//---------------------------------------------------------------------
+
+template <typename PatternChar, typename SubjectChar>
+inline bool CharCompare(const PatternChar* pattern,
+                        const SubjectChar* subject,
+                        int length) {
+  DCHECK(length > 0);
+  int pos = 0;
+  do {
+    if (pattern[pos] != subject[pos]) {
+      return false;
+    }
+    pos++;
+  } while (pos < length);
+  return true;
+}
+
+
+#ifdef V8_STRING_SEARCH_SSE2
+
+// Character width specific SSE2 operations. A 128-bit block holds
+// kBlockLength subject characters.
+template <typename Char>
+struct Sse2Chars;
+
+template <>
+struct Sse2Chars<uint8_t> {
+  static const int kBlockLength = 16;
+  static __m128i Splat(uint8_t c) {
+    return _mm_set1_epi8(static_cast<char>(c));
+  }
+  static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+};
+
+template <>
+struct Sse2Chars<uc16> {
+  static const int kBlockLength = 8;
+  static __m128i Splat(uc16 c) {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+};
+
+
+// Looks for the pattern at the candidate positions *index .. limit, a whole
+// block at a time: a position is only a candidate if both the first and the
+// last pattern character match, which rules out nearly all positions before
+// any per-character work is done. Returns the first match, or -1 after
+// advancing *index to the first position that did not fit in a whole block;
+// the caller scans the remaining positions. The pattern characters must be
+// representable as SubjectChar.
+template <typename PatternChar, typename SubjectChar>
+inline int Sse2FirstLastSearch(const PatternChar* pattern, int pattern_length,
+                               const SubjectChar* subject, int* index,
+                               int limit) {
+  typedef Sse2Chars<SubjectChar> Chars;
+  const int kBlockLength = Chars::kBlockLength;
+  const int kCharMask = (1 << sizeof(SubjectChar)) - 1;
+  const int last_offset = pattern_length - 1;
+  const __m128i first = Chars::Splat(static_cast<SubjectChar>(pattern[0]));
+  const __m128i last =
+      Chars::Splat(static_cast<SubjectChar>(pattern[last_offset]));
+  int i = *index;
+  // The last block read ends at subject[limit + last_offset], which is the
+  // last subject character.
+  for (; i <= limit - kBlockLength + 1; i += kBlockLength) {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + i));
+    __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + i + last_offset));
+    int mask = _mm_movemask_epi8(_mm_and_si128(
+        Chars::Equal(block_first, first), Chars::Equal(block_last, last)));
+    while (mask != 0) {
+      int bit = base::bits::CountTrailingZeros32(mask);
+      int candidate = i + bit / static_cast<int>(sizeof(SubjectChar));
+      if (pattern_length <= 2 ||
+          CharCompare(pattern + 1, subject + candidate + 1,
+                      pattern_length - 2)) {
+        return candidate;
+      }
+      // Clear all mask bits of the rejected character.
+      mask &= ~(kCharMask << bit);
+    }
+  }
+  *index = i;
+  return -1;
+}
+
+#endif  // V8_STRING_SEARCH_SSE2
+
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -214,6 +314,11 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
     }
     SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
     int n = subject.length();
+#ifdef V8_STRING_SEARCH_SSE2
+    int found = Sse2FirstLastSearch(search->pattern_.start(), 1,
+                                    subject.start(), &i, n - 1);
+    if (found != -1) return found;
+#endif
     while (i < n) {
       if (subject[i++] == search_char) return i - 1;
     }
@@ -226,22 +331,6 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
 //---------------------------------------------------------------------
 
 
-template <typename PatternChar, typename SubjectChar>
-inline bool CharCompare(const PatternChar* pattern,
-                        const SubjectChar* subject,
-                        int length) {
-  DCHECK(length > 0);
-  int pos = 0;
-  do {
-    if (pattern[pos] != subject[pos]) {
-      return false;
-    }
-    pos++;
-  } while (pos < length);
-  return true;
-}
-
-
 // Simple linear search for short patterns. Never bails out.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
@@ -254,6 +343,11 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   PatternChar pattern_first_char = pattern[0];
   int i = index;
   int n = subject.length() - pattern_length;
+#ifdef V8_STRING_SEARCH_SSE2
+  int found = Sse2FirstLastSearch(pattern.start(), pattern_length,
+                                  subject.start(), &i, n);
+  if (found != -1) return found;
+#endif
   while (i <= n) {
     if (sizeof(SubjectChar) == 1 && sizeof(PatternChar) == 1) {
       const SubjectChar* pos = reinterpret_cast<const SubjectChar*>(
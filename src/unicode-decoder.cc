@@ -10,6 +10,15 @@
 
 namespace unibrow {
 
+// Returns the length of the run of ASCII bytes at the start of the stream,
+// looking at no more than limit bytes.
+static size_t AsciiRunLength(const uint8_t* stream, size_t limit) {
+  size_t run = 0;
+  while (run < limit && stream[run] <= Utf8::kMaxOneByteChar) run++;
+  return run;
+}
+
+
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const uint8_t* stream, size_t stream_length) {
   // Assume everything will fit in the buffer and stream won't be needed.
@@ -20,6 +29,29 @@ void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
   // Loop until stream is read, writing to buffer as long as buffer has space.
   size_t utf16_length = 0;
   while (stream_length != 0) {
+    if (*stream <= Utf8::kMaxOneByteChar &&
+        (!writing_to_buffer || utf16_length < buffer_length)) {
+      // ASCII characters decode to themselves, so runs of them are copied
+      // (or only counted) without going through ValueOf.
+      size_t limit = stream_length;
+      if (writing_to_buffer) {
+        limit = v8::internal::Min(limit, buffer_length - utf16_length);
+      }
+      size_t run = AsciiRunLength(stream, limit);
+      if (writing_to_buffer) {
+        v8::internal::CopyChars(buffer, stream, run);
+        buffer += run;
+      }
+      stream += run;
+      stream_length -= run;
+      utf16_length += run;
+      if (writing_to_buffer && utf16_length == buffer_length) {
+        writing_to_buffer = false;
+        unbuffered_start_ = stream;
+        unbuffered_length_ = stream_length;
+      }
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     DCHECK(cursor > 0 && cursor <= stream_length);
@@ -62,6 +94,16 @@ void Utf8DecoderBase::WriteUtf16Slow(const uint8_t* stream,
                                      size_t stream_length, uint16_t* data,
                                      size_t data_length) {
   while (data_length != 0) {
+    if (*stream <= Utf8::kMaxOneByteChar) {
+      size_t run = AsciiRunLength(
+          stream, v8::internal::Min(stream_length, data_length));
+      v8::internal::CopyChars(data, stream, run);
+      data += run;
+      stream += run;
+      stream_length -= run;
+      data_length -= run;
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     // There's a total lack of bounds checking for stream
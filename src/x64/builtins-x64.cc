@@ -763,18 +763,19 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ bind(&ok);
   }
 
-  // Load bytecode offset and dispatch table into registers.
+  // Load accumulator, bytecode offset and dispatch table into registers.
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kUndefinedValueRootIndex);
   __ movp(r12, Immediate(BytecodeArray::kHeaderSize - kHeapObjectTag));
   __ LoadRoot(r15, Heap::kInterpreterTableRootIndex);
   __ addp(r15, Immediate(FixedArray::kHeaderSize - kHeapObjectTag));
 
   // Dispatch to the first bytecode handler for the function.
-  __ movzxbp(rax, Operand(r14, r12, times_1, 0));
-  __ movp(rax, Operand(r15, rax, times_pointer_size, 0));
+  __ movzxbp(rbx, Operand(r14, r12, times_1, 0));
+  __ movp(rbx, Operand(r15, rbx, times_pointer_size, 0));
   // TODO(rmcilroy): Make dispatch table point to code entrys to avoid untagging
   // and header removal.
-  __ addp(rax, Immediate(Code::kHeaderSize - kHeapObjectTag));
-  __ jmp(rax);
+  __ addp(rbx, Immediate(Code::kHeaderSize - kHeapObjectTag));
+  __ jmp(rbx);
 }
 
 
@@ -785,9 +786,8 @@ void Builtins::Generate_InterpreterExitTrampoline(MacroAssembler* masm) {
   //  - Support profiler (specifically decrementing profiling_counter
   //    appropriately and calling out to HandleInterrupts if necessary).
 
-  // Load return value into r0.
-  __ movp(rax, Operand(rbp, -kPointerSize -
-                                StandardFrameConstants::kFixedFrameSizeFromFp));
+  // The return value is in accumulator, which is already in rax.
+
   // Leave the frame (also dropping the register file).
   __ leave();
   // Return droping receiver + arguments.
@@ -20,6 +20,7 @@ const Register kReturnRegister0 = {kRegister_rax_Code};
 const Register kReturnRegister1 = {kRegister_rdx_Code};
 const Register kJSFunctionRegister = {kRegister_rdi_Code};
 const Register kContextRegister = {kRegister_rsi_Code};
+const Register kInterpreterAccumulatorRegister = {kRegister_rax_Code};
 const Register kInterpreterBytecodeOffsetRegister = {kRegister_r12_Code};
 const Register kInterpreterBytecodeArrayRegister = {kRegister_r14_Code};
 const Register kInterpreterDispatchTableRegister = {kRegister_r15_Code};
@@ -18,6 +18,7 @@ const Register kReturnRegister0 = {kRegister_eax_Code};
 const Register kReturnRegister1 = {kRegister_edx_Code};
 const Register kJSFunctionRegister = {kRegister_edi_Code};
 const Register kContextRegister = {kRegister_esi_Code};
+const Register kInterpreterAccumulatorRegister = {kRegister_eax_Code};
 const Register kInterpreterBytecodeOffsetRegister = {kRegister_ecx_Code};
 const Register kInterpreterBytecodeArrayRegister = {kRegister_edi_Code};
 const Register kInterpreterDispatchTableRegister = {kRegister_ebx_Code};
@@ -0,0 +1,185 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <utility>
+
+#include "src/compiler/pipeline.h"
+#include "src/execution.h"
+#include "src/handles.h"
+#include "src/interpreter/bytecode-array-builder.h"
+#include "src/interpreter/interpreter.h"
+#include "src/parser.h"
+#include "test/cctest/cctest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+
+class BytecodeGraphCallable {
+ public:
+  BytecodeGraphCallable(Isolate* isolate, Handle<JSFunction> function)
+      : isolate_(isolate), function_(function) {}
+  virtual ~BytecodeGraphCallable() {}
+
+  MaybeHandle<Object> operator()() {
+    return Execution::Call(isolate_, function_,
+                           isolate_->factory()->undefined_value(), 0, nullptr,
+                           false);
+  }
+
+ private:
+  Isolate* isolate_;
+  Handle<JSFunction> function_;
+};
+
+
+class BytecodeGraphTester {
+ public:
+  BytecodeGraphTester(Isolate* isolate, Zone* zone,
+                      Handle<BytecodeArray> bytecode)
+      : isolate_(isolate), zone_(zone), bytecode_(bytecode) {
+    i::FLAG_ignition = true;
+    i::FLAG_always_opt = false;
+    // Ensure handler table is generated.
+    isolate->interpreter()->Initialize();
+  }
+  virtual ~BytecodeGraphTester() {}
+
+  BytecodeGraphCallable GetCallable() {
+    return BytecodeGraphCallable(isolate_, GetFunction());
+  }
+
+ private:
+  Isolate* isolate_;
+  Zone* zone_;
+  Handle<BytecodeArray> bytecode_;
+
+  Handle<JSFunction> GetFunction() {
+    Handle<JSFunction> function = v8::Utils::OpenHandle(
+        *v8::Handle<v8::Function>::Cast(CompileRun("(function(){})")));
+    function->ReplaceCode(*isolate_->builtins()->InterpreterEntryTrampoline());
+    function->shared()->set_function_data(*bytecode_);
+
+    // Optimize the function straight from its bytecode, without parsing it.
+    ParseInfo parse_info(zone_, function);
+    CompilationInfo compilation_info(&parse_info);
+    compilation_info.SetOptimizing(BailoutId::None(),
+                                   Handle<Code>(function->code()));
+    compilation_info.MarkAsOptimizeFromBytecode();
+    CHECK(compilation_info.function() == nullptr);
+
+    Pipeline pipeline(&compilation_info);
+    Handle<Code> code = pipeline.GenerateCode();
+    CHECK(!code.is_null());
+    function->ReplaceCode(*code);
+
+    return function;
+  }
+
+  DISALLOW_COPY_AND_ASSIGN(BytecodeGraphTester);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+
+using namespace v8::internal;
+using namespace v8::internal::compiler;
+using namespace v8::internal::interpreter;
+
+
+TEST(BytecodeGraphBuilderReturnStatements) {
+  HandleAndZoneScope scope;
+  Isolate* isolate = scope.main_isolate();
+  Zone* zone = scope.main_zone();
+  Factory* factory = isolate->factory();
+
+  std::pair<BytecodeArrayBuilder& (BytecodeArrayBuilder::*)(),
+            Handle<Object>> oddballs[] = {
+      std::make_pair(&BytecodeArrayBuilder::LoadUndefined,
+                     factory->undefined_value()),
+      std::make_pair(&BytecodeArrayBuilder::LoadNull, factory->null_value()),
+      std::make_pair(&BytecodeArrayBuilder::LoadTrue, factory->true_value()),
+      std::make_pair(&BytecodeArrayBuilder::LoadFalse, factory->false_value()),
+  };
+  for (size_t i = 0; i < arraysize(oddballs); i++) {
+    BytecodeArrayBuilder builder(isolate);
+    builder.set_locals_count(1);
+    (builder.*oddballs[i].first)().Return();
+
+    BytecodeGraphTester tester(isolate, zone, builder.ToBytecodeArray());
+    BytecodeGraphCallable callable(tester.GetCallable());
+    Handle<Object> return_value = callable().ToHandleChecked();
+    CHECK(return_value.is_identical_to(oddballs[i].second));
+  }
+
+  int smis[] = {0, -128, -1, 1, 127};
+  for (size_t i = 0; i < arraysize(smis); i++) {
+    BytecodeArrayBuilder builder(isolate);
+    builder.set_locals_count(1);
+    builder.LoadLiteral(Smi::FromInt(smis[i])).Return();
+
+    BytecodeGraphTester tester(isolate, zone, builder.ToBytecodeArray());
+    BytecodeGraphCallable callable(tester.GetCallable());
+    Handle<Object> return_value = callable().ToHandleChecked();
+    CHECK_EQ(smis[i], Handle<Smi>::cast(return_value)->value());
+  }
+}
+
+
+TEST(BytecodeGraphBuilderRegisters) {
+  HandleAndZoneScope scope;
+  Isolate* isolate = scope.main_isolate();
+  Zone* zone = scope.main_zone();
+
+  BytecodeArrayBuilder builder(isolate);
+  builder.set_locals_count(3);
+  builder.LoadLiteral(Smi::FromInt(3))
+      .StoreAccumulatorInRegister(interpreter::Register(0))
+      .LoadLiteral(Smi::FromInt(-9))
+      .StoreAccumulatorInRegister(interpreter::Register(2))
+      .LoadTrue()
+      .LoadAccumulatorWithRegister(interpreter::Register(0))
+      .Return();
+
+  BytecodeGraphTester tester(isolate, zone, builder.ToBytecodeArray());
+  BytecodeGraphCallable callable(tester.GetCallable());
+  Handle<Object> return_value = callable().ToHandleChecked();
+  CHECK_EQ(3, Handle<Smi>::cast(return_value)->value());
+}
+
+
+TEST(BytecodeGraphBuilderBinaryOperations) {
+  HandleAndZoneScope scope;
+  Isolate* isolate = scope.main_isolate();
+  Zone* zone = scope.main_zone();
+
+  struct {
+    Token::Value op;
+    int left;
+    int right;
+    double expected;
+  } cases[] = {
+      {Token::ADD, 3, 4, 7.0},
+      {Token::SUB, 3, 4, -1.0},
+      {Token::MUL, -3, 4, -12.0},
+      {Token::DIV, 3, 4, 0.75},
+  };
+  for (size_t i = 0; i < arraysize(cases); i++) {
+    BytecodeArrayBuilder builder(isolate);
+    builder.set_locals_count(1);
+    builder.LoadLiteral(Smi::FromInt(cases[i].left))
+        .StoreAccumulatorInRegister(interpreter::Register(0))
+        .LoadLiteral(Smi::FromInt(cases[i].right))
+        .BinaryOperation(cases[i].op, interpreter::Register(0))
+        .Return();
+
+    BytecodeGraphTester tester(isolate, zone, builder.ToBytecodeArray());
+    BytecodeGraphCallable callable(tester.GetCallable());
+    Handle<Object> return_value = callable().ToHandleChecked();
+    CHECK_EQ(cases[i].expected, return_value->Number());
+  }
+}
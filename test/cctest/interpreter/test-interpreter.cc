@@ -83,3 +83,105 @@ TEST(TestInterpreterReturn) {
   Handle<Object> return_val = callable().ToHandleChecked();
   CHECK(return_val.is_identical_to(undefined_value));
 }
+
+
+TEST(TestInterpreterLoadLiteral) {
+  InitializedHandleScope handles;
+  i::Factory* factory = handles.main_isolate()->factory();
+
+  // Small Smis.
+  for (int i = -128; i < 128; i++) {
+    BytecodeArrayBuilder builder(handles.main_isolate());
+    builder.set_locals_count(1);
+    builder.LoadLiteral(Smi::FromInt(i)).Return();
+    Handle<BytecodeArray> bytecode_array = builder.ToBytecodeArray();
+
+    InterpreterTester tester(handles.main_isolate(), bytecode_array);
+    InterpreterCallable callable(tester.GetCallable());
+    Handle<Object> return_val = callable().ToHandleChecked();
+    CHECK_EQ(Smi::cast(*return_val), Smi::FromInt(i));
+  }
+
+  // Oddballs.
+  struct {
+    BytecodeArrayBuilder& (BytecodeArrayBuilder::*load)();
+    Handle<Object> expected;
+  } oddballs[] = {
+      {&BytecodeArrayBuilder::LoadUndefined, factory->undefined_value()},
+      {&BytecodeArrayBuilder::LoadNull, factory->null_value()},
+      {&BytecodeArrayBuilder::LoadTheHole, factory->the_hole_value()},
+      {&BytecodeArrayBuilder::LoadTrue, factory->true_value()},
+      {&BytecodeArrayBuilder::LoadFalse, factory->false_value()},
+  };
+  for (size_t i = 0; i < arraysize(oddballs); i++) {
+    BytecodeArrayBuilder builder(handles.main_isolate());
+    builder.set_locals_count(1);
+    (builder.*oddballs[i].load)().Return();
+    Handle<BytecodeArray> bytecode_array = builder.ToBytecodeArray();
+
+    InterpreterTester tester(handles.main_isolate(), bytecode_array);
+    InterpreterCallable callable(tester.GetCallable());
+    Handle<Object> return_val = callable().ToHandleChecked();
+    CHECK(return_val.is_identical_to(oddballs[i].expected));
+  }
+}
+
+
+TEST(TestInterpreterLoadStoreRegisters) {
+  InitializedHandleScope handles;
+  Handle<Object> true_value = handles.main_isolate()->factory()->true_value();
+  for (int i = 0; i <= interpreter::Register::kMaxRegisterIndex; i++) {
+    BytecodeArrayBuilder builder(handles.main_isolate());
+    builder.set_locals_count(i + 1);
+    interpreter::Register reg(i);
+    builder.LoadTrue()
+        .StoreAccumulatorInRegister(reg)
+        .LoadFalse()
+        .LoadAccumulatorWithRegister(reg)
+        .Return();
+    Handle<BytecodeArray> bytecode_array = builder.ToBytecodeArray();
+
+    InterpreterTester tester(handles.main_isolate(), bytecode_array);
+    InterpreterCallable callable(tester.GetCallable());
+    Handle<Object> return_val = callable().ToHandleChecked();
+    CHECK(return_val.is_identical_to(true_value));
+  }
+}
+
+
+TEST(TestInterpreterBytecodeGenerator) {
+  bool old_ignition = i::FLAG_ignition;
+  i::FLAG_ignition = true;
+  const char* old_filter = i::FLAG_ignition_filter;
+  i::FLAG_ignition_filter = "f*";
+  LocalContext env;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->interpreter()->Initialize();
+  v8::HandleScope scope(CcTest::isolate());
+
+  struct {
+    const char* name;
+    const char* source;
+    bool interpreted;
+    int expected;
+  } cases[] = {
+      {"f1", "function f1() { return 42; }; f1();", true, 42},
+      {"f2", "function f2() { var a = -7; var b; b = a; return b; }; f2();",
+       true, -7},
+      {"f3", "function f3() { var a; a = 3; 4; return a; }; f3();", true, 3},
+      {"f4", "function f4() { var a = 3; return a + 4; }; f4();", false, 7},
+      {"f5", "function f5(x) { return x; }; f5(9);", false, 9},
+      {"f6", "function f6() { return 1000; }; f6();", false, 1000},
+      {"g1", "function g1() { return 5; }; g1();", false, 5},
+  };
+  for (size_t i = 0; i < arraysize(cases); i++) {
+    v8::Local<v8::Value> result = CompileRun(cases[i].source);
+    CHECK_EQ(cases[i].expected, result->Int32Value());
+    Handle<JSFunction> function = v8::Utils::OpenHandle(
+        *v8::Handle<v8::Function>::Cast(CompileRun(cases[i].name)));
+    CHECK_EQ(cases[i].interpreted, function->shared()->HasBytecodeArray());
+  }
+
+  i::FLAG_ignition = old_ignition;
+  i::FLAG_ignition_filter = old_filter;
+}
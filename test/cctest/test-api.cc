@@ -7275,6 +7275,43 @@ THREADED_TEST(StringWrite) {
 }
 
 
+THREADED_TEST(Utf8AsciiRuns) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  // Long ASCII runs around Latin1 and two-byte characters, including a
+  // surrogate pair right after a run.
+  const char* utf8[] = {
+      "abcdefghijklmnopqrstuvwxyz\303\251ABCDEFGHIJKLMNOPQRSTUVWXYZ\303\251",
+      "abcdefghijklmnop\342\230\203qrstuvwxyz0123456789\360\220\220\210xyz",
+  };
+  for (size_t i = 0; i < arraysize(utf8); i++) {
+    int length = static_cast<int>(strlen(utf8[i]));
+    Local<String> str = String::NewFromUtf8(isolate, utf8[i]);
+    CHECK_EQ(length, str->Utf8Length());
+    char buf[100];
+    int nchars;
+    int written = str->WriteUtf8(buf, sizeof(buf), &nchars);
+    CHECK_EQ(length + 1, written);
+    CHECK_EQ(str->Length(), nchars);
+    CHECK_EQ(0, strcmp(utf8[i], buf));
+    // Running out of capacity stops at a character boundary.
+    for (int capacity = 0; capacity < length; capacity++) {
+      memset(buf, 0x1, sizeof(buf));
+      written = str->WriteUtf8(
+          buf, capacity, &nchars,
+          String::NO_NULL_TERMINATION | String::REPLACE_INVALID_UTF8);
+      CHECK_LE(written, capacity);
+      CHECK_EQ(0, memcmp(utf8[i], buf, written));
+      CHECK_EQ(0x1, buf[written]);
+      Local<String> prefix = String::NewFromUtf8(
+          isolate, buf, String::kNormalString, written);
+      CHECK_EQ(written, prefix->Utf8Length());
+    }
+  }
+}
+
+
 static void Utf16Helper(
     LocalContext& context,  // NOLINT
     const char* name,
@@ -15532,6 +15569,40 @@ THREADED_TEST(GetHeapStatistics) {
 }
 
 
+TEST(CompilationCacheBudget) {
+  if (!i::FLAG_compilation_cache) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CcTest::i_isolate()->compilation_cache()->Clear();
+
+  // Scripts are cached on their second compilation, and hit on the third.
+  v8::CompilationCacheStatistics before;
+  isolate->GetCompilationCacheStatistics(&before);
+  for (int i = 0; i < 3; i++) CompileRun("var cache_a = 1 + 2;");
+  v8::CompilationCacheStatistics stats;
+  isolate->GetCompilationCacheStatistics(&stats);
+  CHECK_EQ(before.hits() + 1, stats.hits());
+  CHECK_LT(0u, stats.cached_bytes());
+  CHECK_EQ(0u, stats.budget());
+
+  // Make room for just one script; caching another one evicts the first.
+  size_t budget = stats.cached_bytes();
+  isolate->SetCompilationCacheBudget(budget);
+  for (int i = 0; i < 2; i++) CompileRun("var cache_b = 3 + 4;");
+  isolate->GetCompilationCacheStatistics(&stats);
+  CHECK_EQ(budget, stats.budget());
+  CHECK_LE(stats.cached_bytes(), budget);
+  CHECK_LT(before.evictions(), stats.evictions());
+
+  size_t misses = stats.misses();
+  CompileRun("var cache_a = 1 + 2;");
+  isolate->GetCompilationCacheStatistics(&stats);
+  CHECK_EQ(misses + 1, stats.misses());
+  isolate->SetCompilationCacheBudget(0);
+}
+
+
 class VisitorImpl : public v8::ExternalResourceVisitor {
  public:
   explicit VisitorImpl(TestResource** resource) {
@@ -19091,6 +19162,24 @@ THREADED_TEST(JSONParseNumber) {
 }
 
 
+THREADED_TEST(JSONParseExternalOneByte) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  const char* json =
+      "{\"a\": [1, -2, 1234567890123, 1.5], \"b\": \"x\\ny\", "
+      "\"c\": {\"d\": null}}";
+  Local<String> source =
+      String::NewExternal(isolate, new TestOneByteResource(i::StrDup(json)));
+  CHECK(v8::Utils::OpenHandle(*source)->IsExternalOneByteString());
+  Local<Value> obj = v8::JSON::Parse(source);
+  context->Global()->Set(v8_str("obj"), obj);
+  ExpectString("JSON.stringify(obj)",
+               "{\"a\":[1,-2,1234567890123,1.5],\"b\":\"x\\ny\","
+               "\"c\":{\"d\":null}}");
+}
+
+
 #if V8_OS_POSIX && !V8_OS_NACL
 class ThreadInterruptTest {
  public:
@@ -20685,6 +20774,38 @@ TEST(StreamingBiggerScript) {
 }
 
 
+TEST(StreamingEagerTopLevelFunctions) {
+  // Top-level functions of a streamed script are fully parsed on the
+  // background thread and compiled without being called.
+  i::FLAG_parse_streamed_functions_eagerly = true;
+  const char* chunks[] = {"function foo() { return 13; } ",
+                          "function bar() { return 42; } foo(); ", NULL};
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+  task->Run();
+  delete task;
+
+  v8::ScriptOrigin origin(v8_str("http://foo.com"));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::Handle<Script> script = v8::ScriptCompiler::Compile(
+      isolate, &source, v8_str(full_source), origin);
+  CHECK(!script.IsEmpty());
+  CHECK_EQ(13, script->Run()->Int32Value());
+  delete[] full_source;
+
+  i::Handle<i::JSFunction> bar = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()->Get(v8_str("bar"))));
+  CHECK(bar->shared()->is_compiled());
+}
+
+
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
   {
@@ -21827,3 +21948,69 @@ TEST(EstimatedContextSize) {
   LocalContext env;
   CHECK(50000 < env->EstimatedSize());
 }
+
+
+static const char* discarded_script_source = NULL;
+static int script_source_callback_count = 0;
+
+
+static v8::Local<v8::String> ScriptSourceCallback(
+    v8::Isolate* isolate, int script_id, v8::Local<v8::Value> resource_name) {
+  script_source_callback_count++;
+  CHECK(resource_name->Equals(v8_str("discard.js")));
+  return v8_str(discarded_script_source);
+}
+
+
+TEST(DiscardScriptSources) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+  isolate->SetScriptSourceCallback(ScriptSourceCallback);
+
+  discarded_script_source =
+      "function f() { return 1; }\n"
+      "function g() {\n"
+      "  throw new Error('g');\n"
+      "}\n"
+      "f();\n"
+      "try { g(); } catch (e) {}\n";
+  CompileRunWithOrigin(discarded_script_source, "discard.js");
+  // Scripts with lazy functions or calls to eval keep their source.
+  CompileRunWithOrigin("function lazy() { return 2; }", "lazy.js");
+  CompileRunWithOrigin("function e() { return eval('3'); } e();", "eval.js");
+  // Neither eval at the top level nor eval in a block scope with declarations
+  // is recorded on the enclosing function's scope info.
+  v8::Local<v8::Script> top_level_eval =
+      CompileWithOrigin("eval('4');", "top-level-eval.js");
+  CHECK_EQ(4, top_level_eval->Run()->Int32Value());
+  CompileRunWithOrigin(
+      "function h() {\n"
+      "  for (let i = 0; i < 1; i++) return eval('i + 5');\n"
+      "}\n"
+      "h();\n",
+      "block-eval.js");
+
+  isolate->DiscardScriptSources();
+  CHECK_EQ(0, script_source_callback_count);
+
+  CHECK_EQ(4, top_level_eval->Run()->Int32Value());
+  ExpectInt32("h()", 5);
+  CHECK_EQ(0, script_source_callback_count);
+
+  // Positions are resolved with the line ends computed before discarding.
+  v8::TryCatch try_catch(isolate);
+  CompileRun("g()");
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(3, try_catch.Message()->GetLineNumber());
+
+  ExpectInt32("f()", 1);
+  ExpectString("lazy.toString()", "function lazy() { return 2; }");
+  ExpectString("e.toString()", "function e() { return eval('3'); }");
+
+  // The source of the discarded script is requested again when needed.
+  ExpectString("f.toString()", "function f() { return 1; }");
+  CHECK_LT(0, script_source_callback_count);
+  ExpectString("g.toString()",
+               "function g() {\n  throw new Error('g');\n}");
+}
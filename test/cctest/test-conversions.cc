@@ -307,6 +307,29 @@ TEST(ExponentNumberStr) {
 }
 
 
+static void CheckDoubleToCString(const char* expected, double value) {
+  char buffer[100];
+  Vector<char> vector(buffer, arraysize(buffer));
+  CHECK_EQ(0, strcmp(expected, DoubleToCString(value, vector)));
+}
+
+
+TEST(DoubleToCString) {
+  CheckDoubleToCString("0", -0.0);
+  CheckDoubleToCString("1", 1.0);
+  CheckDoubleToCString("-2147483649", -2147483649.0);
+  CheckDoubleToCString("1445000000000", 1445000000000.0);
+  CheckDoubleToCString("9007199254740991", 9007199254740991.0);
+  CheckDoubleToCString("-9007199254740991", -9007199254740991.0);
+  CheckDoubleToCString("9007199254740992", 9007199254740992.0);
+  CheckDoubleToCString("1e+21", 1e21);
+  CheckDoubleToCString("123456789012345680000", 123456789012345678901.0);
+  CheckDoubleToCString("0.5", 0.5);
+  CheckDoubleToCString("-1.5", -1.5);
+  CheckDoubleToCString("1e-7", 1e-7);
+}
+
+
 class OneBit1: public BitField<uint32_t, 0, 1> {};
 class OneBit2: public BitField<uint32_t, 7, 1> {};
 class EightBit1: public BitField<uint32_t, 0, 8> {};
@@ -36,6 +36,7 @@
 #include "src/debug/debug.h"
 #include "src/deoptimizer.h"
 #include "src/frames.h"
+#include "src/interpreter/interpreter.h"
 #include "src/utils.h"
 #include "test/cctest/cctest.h"
 
@@ -970,6 +971,48 @@ TEST(BreakPointICStore) {
 }
 
 
+// Test that a break point can be set in a function that runs in the
+// interpreter. Setting it recompiles the function with full-codegen, which has
+// to drop its bytecode.
+TEST(BreakPointInInterpretedFunction) {
+  bool old_ignition = v8::internal::FLAG_ignition;
+  const char* old_filter = v8::internal::FLAG_ignition_filter;
+  v8::internal::FLAG_ignition = true;
+  v8::internal::FLAG_ignition_filter = "foo";
+  break_point_hit_count = 0;
+  DebugLocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  CcTest::i_isolate()->interpreter()->Initialize();
+
+  v8::Local<v8::Function> foo = CompileFunction(
+      &env, "function foo() { var a = 7; return a; }", "foo");
+  Handle<v8::internal::SharedFunctionInfo> shared(
+      v8::Utils::OpenHandle(*foo)->shared());
+
+  // Run in the interpreter without break points.
+  CHECK_EQ(7, foo->Call(env->Global(), 0, NULL)->Int32Value());
+  CHECK(shared->HasBytecodeArray());
+
+  // Run with break point.
+  v8::Debug::SetDebugEventListener(DebugEventBreakPointHitCount);
+  int bp = SetBreakPoint(foo, 0);
+  CHECK(!shared->HasBytecodeArray());
+  CHECK_EQ(Code::FUNCTION, shared->code()->kind());
+  CHECK_EQ(7, foo->Call(env->Global(), 0, NULL)->Int32Value());
+  CHECK_EQ(1, break_point_hit_count);
+
+  // Run without break points.
+  ClearBreakPoint(bp);
+  CHECK_EQ(7, foo->Call(env->Global(), 0, NULL)->Int32Value());
+  CHECK_EQ(1, break_point_hit_count);
+
+  v8::Debug::SetDebugEventListener(NULL);
+  CheckDebuggerUnloaded();
+  v8::internal::FLAG_ignition = old_ignition;
+  v8::internal::FLAG_ignition_filter = old_filter;
+}
+
+
 // Test that a break point can be set at an IC load location.
 TEST(BreakPointICLoad) {
   break_point_hit_count = 0;
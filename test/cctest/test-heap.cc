@@ -1594,6 +1594,9 @@ TEST(CompilationCacheCachingBehavior) {
     info.ToHandleChecked()->code()->MakeOlder(NO_MARKING_PARITY);
   }
 
+  // The entry was hit since the last GC, so it survives one more GC even
+  // though its code is old.
+  heap->CollectAllGarbage();
   heap->CollectAllGarbage();
   // Ensure code aging cleared the entry from the cache.
   info = compilation_cache->LookupScript(
@@ -2685,6 +2688,106 @@ TEST(PrototypeTransitionClearing) {
 }
 
 
+TEST(PrototypeTransitionTrimming) {
+  if (FLAG_never_compact) return;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun("var base = {};");
+  Handle<JSObject> baseObject =
+      v8::Utils::OpenHandle(
+          *v8::Handle<v8::Object>::Cast(
+              CcTest::global()->Get(v8_str("base"))));
+  int initialTransitions = NumberOfProtoTransitions(baseObject->map());
+
+  CompileRun(
+      "var live = [];"
+      "for (var i = 0; i < 20; i++) {"
+      "  var object = {};"
+      "  var prototype = {};"
+      "  object.__proto__ = prototype;"
+      "  if (i >= 18) live.push(object, prototype);"
+      "}");
+
+  const int header = TransitionArray::kProtoTransitionHeaderSize;
+  FixedArray* trans =
+      TransitionArray::GetPrototypeTransitions(baseObject->map());
+  CHECK_LE(initialTransitions + 20, trans->length() - header);
+
+  // Verify that a mostly dead prototype transitions array is right-trimmed
+  // down to its live entries.
+  CcTest::heap()->CollectAllGarbage();
+  const int transitions = initialTransitions + 2;
+  CHECK_EQ(transitions, NumberOfProtoTransitions(baseObject->map()));
+  trans = TransitionArray::GetPrototypeTransitions(baseObject->map());
+  CHECK_EQ(transitions, trans->length() - header);
+
+  // Verify that the trimmed array grows again on demand.
+  CompileRun(
+      "var object = {};"
+      "object.__proto__ = {};"
+      "live.push(object);");
+  CHECK_EQ(transitions + 1, NumberOfProtoTransitions(baseObject->map()));
+}
+
+
+TEST(InPlaceSmiToDoubleElementsTransition) {
+  if (kDoubleSize != kPointerSize) return;
+  i::FLAG_in_place_elements_widening = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "var a = [];"
+      "for (var i = 0; i < 100; i++) a.push(i);"
+      "delete a[7];");
+  Handle<JSArray> array = v8::Utils::OpenHandle(
+      *v8::Handle<v8::Array>::Cast(CcTest::global()->Get(v8_str("a"))));
+  CHECK(array->HasFastSmiElements());
+  Handle<FixedArrayBase> elements(array->elements());
+  if (CcTest::heap()->incremental_marking()->IsMarking()) return;
+
+  CompileRun("a[5] = 1.5;");
+  CHECK(array->HasFastDoubleElements());
+  // The backing store was widened in place rather than copied.
+  CHECK_EQ(*elements, array->elements());
+  FixedDoubleArray* doubles = FixedDoubleArray::cast(array->elements());
+  CHECK_EQ(1.5, doubles->get_scalar(5));
+  CHECK(doubles->is_the_hole(7));
+  for (int i = 0; i < 100; i++) {
+    if (i == 5 || i == 7) continue;
+    CHECK_EQ(static_cast<double>(i), doubles->get_scalar(i));
+  }
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_EQ(42, CompileRun("a[42]")->Int32Value());
+}
+
+
+TEST(DescriptorLookupCacheSurvivesScavenge) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun("var o = { a: 1, b: 2, c: 3 };");
+  Handle<JSObject> object = v8::Utils::OpenHandle(
+      *v8::Handle<v8::Object>::Cast(CcTest::global()->Get(v8_str("o"))));
+  Handle<Map> map(object->map());
+  Handle<String> name = factory->InternalizeUtf8String("b");
+  DescriptorLookupCache* cache = isolate->descriptor_lookup_cache();
+
+  int number = map->instance_descriptors()->SearchWithCache(*name, *map);
+  CHECK_NE(DescriptorArray::kNotFound, number);
+  CHECK_EQ(number, cache->Lookup(*map, *name));
+
+  CcTest::heap()->CollectGarbage(NEW_SPACE);
+  CHECK_EQ(number, cache->Lookup(*map, *name));
+
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_EQ(DescriptorLookupCache::kAbsent, cache->Lookup(*map, *name));
+}
+
+
 TEST(ResetSharedFunctionInfoCountersDuringIncrementalMarking) {
   i::FLAG_stress_compaction = false;
   i::FLAG_allow_natives_syntax = true;
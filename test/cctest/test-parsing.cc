@@ -740,6 +740,29 @@ TEST(Utf8CharacterStream) {
   }
 }
 
+TEST(Utf8CharacterStreamAsciiRuns) {
+  // Long ASCII runs are widened in bulk; make sure multi-byte characters
+  // placed around word and buffer boundaries are still decoded correctly.
+  static const unsigned kLength = 2048;
+  char buffer[kLength * 3];
+  int32_t expected[kLength];
+  unsigned cursor = 0;
+  for (unsigned i = 0; i < kLength; i++) {
+    int32_t c = (i % 37 == 0 || i % 509 == 0) ? 0x3b1 + (i % 7) : 'a' + i % 26;
+    expected[i] = c;
+    cursor += unibrow::Utf8::Encode(buffer + cursor, c,
+                                    unibrow::Utf16::kNoPreviousCharacter, true);
+  }
+
+  i::Utf8ToUtf16CharacterStream stream(reinterpret_cast<const i::byte*>(buffer),
+                                       cursor);
+  for (unsigned i = 0; i < kLength; i++) {
+    CHECK_EQU(i, stream.pos());
+    CHECK_EQ(expected[i], stream.Advance());
+  }
+  CHECK_EQ(-1, stream.Advance());
+}
+
 #undef CHECK_EQU
 
 void TestStreamScanner(i::Utf16CharacterStream* stream,
@@ -3218,6 +3241,58 @@ TEST(RegressionLazyFunctionWithErrorWithArg) {
 }
 
 
+static int preparsed_functions_counter = 0;
+
+
+static int* LookupPreparsedFunctionsCounter(const char* name) {
+  if (strcmp(name, "c:V8.TotalPreparsedFunctions") == 0) {
+    return &preparsed_functions_counter;
+  }
+  return NULL;
+}
+
+
+TEST(LazyInnerFunctionsReusePreparseData) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+  i::FLAG_lazy = true;
+  i::FLAG_min_preparse_length = 0;
+  i::FLAG_reuse_preparse_data = true;
+  isolate->SetCounterFunction(LookupPreparsedFunctionsCounter);
+
+  v8::Local<v8::Value> v = CompileRun(
+      "function outer(x) {\n"
+      "  function middle(y) {\n"
+      "    'use strict';\n"
+      "    function inner(z) { return [x, y, z, { a: 1 }]; }\n"
+      "    return inner(y + 1);\n"
+      "  }\n"
+      "  var arrow = (a) => { return middle(a); };\n"
+      "  return arrow(x + 1);\n"
+      "}\n"
+      "outer;\n");
+  i::Handle<i::JSFunction> outer =
+      i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*v));
+  CHECK(!outer->shared()->is_compiled());
+  i::Handle<i::Script> script(i::Script::cast(outer->shared()->script()));
+  CHECK(script->preparse_data()->IsObjectHashTable());
+  CHECK_LT(0, preparsed_functions_counter);
+
+  // The inner functions are compiled from the data kept on the script, without
+  // preparsing any of them again. Once they are all compiled the data is gone.
+  int preparsed_functions = preparsed_functions_counter;
+  v8::Local<v8::Value> result = CompileRun("outer(1).join()");
+  CHECK_EQ(0, strcmp("1,2,3,[object Object]",
+                     *v8::String::Utf8Value(result)));
+  CHECK(outer->shared()->is_compiled());
+  CHECK_EQ(preparsed_functions, preparsed_functions_counter);
+  CHECK(script->preparse_data()->IsUndefined());
+
+  isolate->SetCounterFunction(NULL);
+}
+
+
 TEST(SerializationOfMaybeAssignmentFlag) {
   i::Isolate* isolate = CcTest::i_isolate();
   i::Factory* factory = isolate->factory();
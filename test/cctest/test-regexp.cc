@@ -517,7 +517,7 @@ static RegExpNode* Compile(const char* input, bool multiline, bool unicode,
   Handle<String> sample_subject =
       isolate->factory()->NewStringFromUtf8(CStrVector("")).ToHandleChecked();
   RegExpEngine::Compile(isolate, zone, &compile_data, false, false, multiline,
-                        false, pattern, sample_subject, is_one_byte);
+                        false, pattern, sample_subject, is_one_byte, false);
   return compile_data.node;
 }
 
@@ -1816,3 +1816,31 @@ TEST(CharacterRangeMerge) {
 TEST(Graph) {
   Execute("\\b\\w+\\b", false, true, true);
 }
+
+
+#ifndef V8_INTERPRETED_REGEXP
+TEST(RegExpTierUp) {
+  i::FLAG_regexp_tier_up = true;
+  i::FLAG_regexp_tier_up_ticks = 1;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  Handle<JSRegExp> regexp = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun("var re = /(a+)b/; re")));
+
+  // The first execution runs in the interpreter.
+  CHECK(CompileRun("re.exec('xaab')[1] == 'aa'")->IsTrue());
+  FixedArray* data = FixedArray::cast(regexp->data());
+  CHECK(data->get(JSRegExp::kIrregexpLatin1BytecodeIndex)->IsByteArray());
+  CHECK(data->get(JSRegExp::kIrregexpLatin1CodeIndex)->IsSmi());
+
+  // The second one compiles native code and drops the bytecode.
+  CHECK(CompileRun("re.exec('xaaab')[1] == 'aaa'")->IsTrue());
+  data = FixedArray::cast(regexp->data());
+  CHECK(data->get(JSRegExp::kIrregexpLatin1CodeIndex)->IsCode());
+  CHECK(data->get(JSRegExp::kIrregexpLatin1BytecodeIndex)->IsSmi());
+  CHECK_EQ(JSRegExp::kTieredUpValue,
+           Smi::cast(data->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))
+               ->value());
+}
+#endif  // V8_INTERPRETED_REGEXP
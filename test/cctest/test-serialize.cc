@@ -757,6 +757,51 @@ TEST(PerIsolateSnapshotBlobsOutdatedContextWithOverflow) {
 }
 
 
+static void SerializedCallback(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  args.GetReturnValue().Set(v8_num(42));
+}
+
+
+static bool InstallSerializedCallback(v8::Isolate* isolate,
+                                      v8::Local<v8::Context> context) {
+  v8::Local<v8::FunctionTemplate> function =
+      v8::FunctionTemplate::New(isolate, SerializedCallback);
+  v8::Local<v8::Function> f = function->GetFunction(context).ToLocalChecked();
+  return context->Global()->Set(context, v8_str("f"), f).FromJust();
+}
+
+
+static intptr_t serialized_callback_references[] = {
+    reinterpret_cast<intptr_t>(SerializedCallback), 0};
+
+
+TEST(PerIsolateSnapshotBlobsWithExternalReferences) {
+  DisableTurbofan();
+  const char* source = "function g() { return f() + 1; }";
+
+  v8::StartupData data = v8::V8::CreateSnapshotDataBlob(
+      source, serialized_callback_references, InstallSerializedCallback);
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &data;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  params.external_references = serialized_callback_references;
+
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    delete[] data.data;  // We can dispose of the snapshot blob now.
+    v8::Context::Scope c_scope(context);
+    CHECK_EQ(42, CompileRun("f()")->ToInt32(isolate)->Int32Value());
+    CHECK_EQ(43, CompileRun("g()")->ToInt32(isolate)->Int32Value());
+  }
+  isolate->Dispose();
+}
+
+
 TEST(PerIsolateSnapshotBlobsWithLocker) {
   DisableTurbofan();
   v8::Isolate::CreateParams create_params;
@@ -1470,6 +1515,57 @@ TEST(SerializeToplevelIsolates) {
 }
 
 
+TEST(SerializeToplevelAfterExecution) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin);
+    v8::Local<v8::UnboundScript> script = v8::ScriptCompiler::CompileUnbound(
+        isolate1, &source, v8::ScriptCompiler::kProduceCodeCache);
+    v8::Local<v8::Value> result = script->BindToCurrentContext()->Run();
+    CHECK(result->ToString(isolate1)->Equals(v8_str("abcdef")));
+
+    // f has been compiled lazily by now and is included in the cache.
+    cache = v8::ScriptCompiler::CreateCodeCache(script, source_str);
+    CHECK(cache);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+    v8::Local<v8::UnboundScript> script = v8::ScriptCompiler::CompileUnbound(
+        isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache);
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> result = script->BindToCurrentContext()->Run();
+    CHECK(result->ToString(isolate2)->Equals(v8_str("abcdef")));
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+
 TEST(SerializeToplevelFlagChange) {
   FLAG_serialize_toplevel = true;
 
@@ -38,6 +38,7 @@
 #include "src/factory.h"
 #include "src/messages.h"
 #include "src/objects.h"
+#include "src/string-search.h"
 #include "src/unicode-decoder.h"
 #include "test/cctest/cctest.h"
 
@@ -1117,6 +1118,28 @@ TEST(SliceFromCons) {
 }
 
 
+TEST(InternalizeCons) {
+  CcTest::InitializeVM();
+  Factory* factory = CcTest::i_isolate()->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  Handle<String> string =
+      factory->NewStringFromStaticChars("parentparentparent");
+  Handle<String> left =
+      factory->NewConsString(string, string).ToHandleChecked();
+  Handle<String> cons = factory->NewConsString(left, string).ToHandleChecked();
+  CHECK(cons->IsConsString());
+  CHECK(!cons->IsFlat());
+  Handle<String> internalized = factory->InternalizeString(cons);
+  CHECK(internalized->IsInternalizedString());
+  CHECK(String::Equals(internalized, cons));
+  // The rope now points at its internalized version.
+  CHECK(cons->IsFlat());
+  CHECK_EQ(*internalized, ConsString::cast(*cons)->first());
+  CHECK(internalized.is_identical_to(factory->InternalizeString(cons)));
+  CHECK(internalized.is_identical_to(String::Flatten(cons)));
+}
+
+
 class OneByteVectorResource : public v8::String::ExternalOneByteStringResource {
  public:
   explicit OneByteVectorResource(i::Vector<const char> vector)
@@ -1479,3 +1502,56 @@ TEST(FormatMessage) {
       "Property 'arg0' of object arg1 is not a function");
   CHECK(String::Equals(result, expected));
 }
+
+
+template <typename PatternChar, typename SubjectChar>
+static int NaiveSearch(Vector<const PatternChar> pattern,
+                       Vector<const SubjectChar> subject, int index) {
+  for (int i = index; i <= subject.length() - pattern.length(); i++) {
+    int j = 0;
+    while (j < pattern.length() && pattern[j] == subject[i + j]) j++;
+    if (j == pattern.length()) return i;
+  }
+  return -1;
+}
+
+
+// Compares StringSearch with a naive search for all start positions. The
+// subjects are long enough to cover the block-wise scans as well as their
+// unaligned heads and tails.
+template <typename PatternChar, typename SubjectChar>
+static void CheckStringSearch(Isolate* isolate, SubjectChar high_char) {
+  MyRandomNumberGenerator rng;
+  for (int subject_length = 0; subject_length < 70; subject_length++) {
+    SubjectChar subject_chars[70];
+    for (int i = 0; i < subject_length; i++) {
+      // Mostly 'a', so that first and last character candidates are common.
+      uint32_t r = rng.next() % 8;
+      subject_chars[i] = r == 0 ? 'b' : (r == 1 ? high_char : 'a');
+    }
+    Vector<const SubjectChar> subject(subject_chars, subject_length);
+    for (int pattern_length = 1; pattern_length <= 8; pattern_length++) {
+      for (int variant = 0; variant < 4; variant++) {
+        PatternChar pattern_chars[8];
+        for (int i = 0; i < pattern_length; i++) pattern_chars[i] = 'a';
+        if (variant & 1) pattern_chars[pattern_length - 1] = 'b';
+        if (variant & 2) pattern_chars[pattern_length / 2] = high_char;
+        Vector<const PatternChar> pattern(pattern_chars, pattern_length);
+        for (int index = 0; index <= subject_length; index++) {
+          CHECK_EQ(NaiveSearch(pattern, subject, index),
+                   SearchString(isolate, subject, pattern, index));
+        }
+      }
+    }
+  }
+}
+
+
+TEST(StringSearch) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  CheckStringSearch<uint8_t, uint8_t>(isolate, 0xe9);
+  CheckStringSearch<uc16, uc16>(isolate, 0x3b1);
+  CheckStringSearch<uint8_t, uc16>(isolate, 0xe9);
+  CheckStringSearch<uc16, uint8_t>(isolate, 0xe9);
+}
@@ -184,3 +184,39 @@ assertEquals(10, Array.prototype.lastIndexOf.call(funky_object, 42));
 assertEquals(-1, Array.prototype.lastIndexOf.call(funky_object, 37));
 
 assertEquals(-1, Array.prototype.lastIndexOf.call(infinite_object, 42));
+
+// Find in fast holey and double arrays.
+var holey_smis = [1, 2, , 4, 2];
+assertEquals(1, holey_smis.indexOf(2));
+assertEquals(4, holey_smis.lastIndexOf(2));
+assertEquals(-1, holey_smis.indexOf(undefined));
+assertEquals(-1, holey_smis.lastIndexOf(undefined));
+assertEquals(3, holey_smis.indexOf(4.0));
+assertEquals(-1, holey_smis.indexOf(4.5));
+assertEquals(-1, holey_smis.indexOf("4"));
+
+var holey_doubles = [1.5, , -0, 2.5, NaN, 1.5];
+assertEquals(0, holey_doubles.indexOf(1.5));
+assertEquals(5, holey_doubles.lastIndexOf(1.5));
+assertEquals(2, holey_doubles.indexOf(0));
+assertEquals(-1, holey_doubles.indexOf(NaN));
+assertEquals(-1, holey_doubles.lastIndexOf(NaN));
+assertEquals(-1, holey_doubles.indexOf(undefined));
+assertEquals(3, holey_doubles.indexOf(2.5, -3));
+assertEquals(-1, holey_doubles.lastIndexOf(2.5, 2));
+
+var holey_objects = ["a", , "b" + "c", undefined, 1.25, 3];
+assertEquals(2, holey_objects.indexOf("bc"));
+assertEquals(3, holey_objects.indexOf(undefined));
+assertEquals(3, holey_objects.lastIndexOf(undefined));
+assertEquals(4, holey_objects.indexOf(1.25));
+assertEquals(5, holey_objects.indexOf(3.0));
+assertEquals(-1, holey_objects.indexOf({}));
+
+// Holes are looked up on the prototype chain.
+Array.prototype[1] = 2.5;
+Array.prototype[2] = 7;
+assertEquals(1, holey_doubles.indexOf(2.5));
+assertEquals(2, holey_smis.lastIndexOf(7));
+delete Array.prototype[1];
+delete Array.prototype[2];
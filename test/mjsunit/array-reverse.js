@@ -0,0 +1,35 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Reverse fast smi, double and object arrays, with and without holes.
+assertEquals([3, 2, 1], [1, 2, 3].reverse());
+assertEquals([3.5, 2.5, 1.5, 0.5], [0.5, 1.5, 2.5, 3.5].reverse());
+assertEquals(["c", {}, "a"], ["a", {}, "c"].reverse());
+
+var holeySmis = [1, , 3, 4];
+holeySmis.reverse();
+assertEquals([4, 3, , 1], holeySmis);
+assertFalse(holeySmis.hasOwnProperty(2));
+assertTrue(holeySmis.hasOwnProperty(1));
+
+var holeyDoubles = [1.5, , 3.5];
+holeyDoubles.reverse();
+assertEquals(3.5, holeyDoubles[0]);
+assertFalse(holeyDoubles.hasOwnProperty(1));
+assertEquals(1.5, holeyDoubles[2]);
+holeyDoubles[1] = 2.5;
+assertEquals([3.5, 2.5, 1.5], holeyDoubles);
+
+function literal() { return [1, 2, 3]; }
+assertEquals([3, 2, 1], literal().reverse());
+assertEquals([1, 2, 3], literal());
+
+// Holes take their value from the prototype chain.
+Array.prototype[1] = "p";
+var holeyObjects = ["a", , "c", "d"];
+holeyObjects.reverse();
+assertEquals(["d", "c", "p", "a"], holeyObjects);
+assertTrue(holeyObjects.hasOwnProperty(1));
+assertTrue(holeyObjects.hasOwnProperty(2));
+delete Array.prototype[1];
@@ -30,3 +30,26 @@ assertArrayEquals(Object.freeze([1, 2, 3]).fill(0, 0, 0), [1, 2, 3]);
 assertThrows('Object.freeze([0]).fill()', TypeError);
 assertThrows('Array.prototype.fill.call(null)', TypeError);
 assertThrows('Array.prototype.fill.call(undefined)', TypeError);
+
+// Fill fast smi, double and object arrays, with and without holes.
+assertArrayEquals([1.5, 2.5, 3.5].fill(0.5, 1), [1.5, 0.5, 0.5]);
+assertArrayEquals([1.5, , 3.5].fill(7, 0, 2), [7, 7, 3.5]);
+assertArrayEquals([1, 2, 3].fill(0.5, 1), [1, 0.5, 0.5]);
+assertArrayEquals([1, 2, 3].fill("x", 2), [1, 2, "x"]);
+assertArrayEquals(["a", , "c"].fill(1, 1), ["a", 1, 1]);
+function literal() { return [1, 2, 3]; }
+assertArrayEquals(literal().fill(9, 1), [1, 9, 9]);
+assertArrayEquals(literal(), [1, 2, 3]);
+
+// Setters on the prototype chain see the stores to holes.
+var stored = [];
+Object.defineProperty(Array.prototype, "1", {
+  set: function(v) { stored.push(v); }, configurable: true
+});
+var withHole = [0, , 2];
+withHole.fill(5);
+assertArrayEquals([5], stored);
+assertEquals(5, withHole[0]);
+assertEquals(5, withHole[2]);
+assertFalse(withHole.hasOwnProperty(1));
+delete Array.prototype[1];
@@ -675,3 +675,41 @@
   assertFalse(Array.prototype.includes.call(new Uint8Array([1, 2, 3]), 4));
   assertFalse(Array.prototype.includes.call(new Uint8Array([1, 2, 3]), 2, 2));
 })();
+
+
+// Fast holey and double arrays.
+(function() {
+  var holeySmis = [1, 2, , 4];
+  assertTrue(holeySmis.includes(4));
+  assertTrue(holeySmis.includes(4.0));
+  assertTrue(holeySmis.includes(undefined));
+  assertFalse(holeySmis.includes(undefined, 3));
+  assertFalse(holeySmis.includes(NaN));
+  assertFalse(holeySmis.includes("4"));
+
+  var holeyDoubles = [1.5, , -0, NaN];
+  assertTrue(holeyDoubles.includes(NaN));
+  assertTrue(holeyDoubles.includes(0));
+  assertTrue(holeyDoubles.includes(undefined));
+  assertFalse(holeyDoubles.includes(undefined, 2));
+  assertFalse(holeyDoubles.includes(2.5));
+  assertFalse([1.5, 2.5].includes(undefined));
+
+  var holeyObjects = ["a", , "b" + "c", NaN, {}];
+  assertTrue(holeyObjects.includes("bc"));
+  assertTrue(holeyObjects.includes(NaN));
+  assertTrue(holeyObjects.includes(undefined));
+  assertFalse(holeyObjects.includes(undefined, 2));
+  assertFalse(holeyObjects.includes({}));
+
+  // Holes are looked up on the prototype chain.
+  Array.prototype[2] = 7;
+  assertTrue(holeySmis.includes(7));
+  assertFalse(holeySmis.includes(undefined));
+  assertFalse(holeyDoubles.includes(7));
+  Array.prototype[1] = 7;
+  assertTrue(holeyDoubles.includes(7));
+  assertFalse(holeyDoubles.includes(undefined));
+  delete Array.prototype[1];
+  delete Array.prototype[2];
+})();
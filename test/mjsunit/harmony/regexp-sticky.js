@@ -130,3 +130,30 @@ mhat.lastIndex = 2;
 assertFalse(mhat.test("..foo"));
 mhat.lastIndex = 2;
 assertTrue(mhat.test(".\nfoo"));
+
+// Sticky regexps that are plain strings only match at lastIndex.
+var atom = /foo/y;
+atom.lastIndex = 1;
+assertFalse(atom.test("..foo"));
+assertEquals(0, atom.lastIndex);
+atom.lastIndex = 2;
+assertTrue(atom.test("..foo"));
+assertEquals(5, atom.lastIndex);
+assertFalse(atom.test("..foo"));
+
+var dot = /\./y;
+dot.lastIndex = 1;
+assertEquals(".", dot.exec("a.b")[0]);
+assertEquals(2, dot.lastIndex);
+assertEquals(null, dot.exec("a.b"));
+
+var wide = /\u1234\u1234/y;
+wide.lastIndex = 1;
+assertEquals(1, wide.exec("a\u1234\u1234").index);
+wide.lastIndex = 0;
+assertEquals(null, wide.exec("a\u1234\u1234"));
+
+assertEquals("xxba", "aaba".replace(/a/gy, "x"));
+assertEquals("ba", "aaba".replace(/a/gy, ""));
+assertEquals("baaa", "baaa".replace(/a/gy, "x"));
+assertEquals(["ab", "ab"], "ababxab".match(/ab/gy));
@@ -482,3 +482,23 @@ assertTrue(Object.prototype.isPrototypeOf(o2));
 
 var json = '{"stuff before slash\\\\stuff after slash":"whatever"}';
 TestStringify(json, JSON.parse(json));
+
+// Integer literals around the Smi and exact double boundaries.
+assertEquals(1073741823, JSON.parse("1073741823"));
+assertEquals(-1073741824, JSON.parse("-1073741824"));
+assertEquals(2147483648, JSON.parse("2147483648"));
+assertEquals(-2147483649, JSON.parse("-2147483649"));
+assertEquals(999999999999999, JSON.parse("999999999999999"));
+assertEquals(-999999999999999, JSON.parse("-999999999999999"));
+assertEquals(9007199254740993, JSON.parse("9007199254740993"));
+assertEquals(12345678901234567890, JSON.parse("12345678901234567890"));
+assertEquals(-Infinity, 1 / JSON.parse("-0"));
+
+// Double fields and strings mixing plain runs with escaped characters.
+var doubles = { a: 1.5, b: -0.25, c: NaN, d: 2 };
+doubles.a = 0.1;
+assertEquals('{"a":0.1,"b":-0.25,"c":null,"d":2}', JSON.stringify(doubles));
+assertEquals('"ab\\"cd\\\\ef\\n\\u0001 !#~\x7f\xff"',
+             JSON.stringify('ab"cd\\ef\n\x01 !#~\x7f\xff'));
+assertEquals('{"k\\"ey":"\u1234\\t\u20ac"}',
+             JSON.stringify({ 'k"ey': '\u1234\t\u20ac' }));
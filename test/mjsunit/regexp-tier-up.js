@@ -0,0 +1,37 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=2
+
+// Results must not change when a regexp moves from the interpreter to
+// native code.
+
+function check(re, subject, expected) {
+  re.lastIndex = 0;
+  assertEquals(expected, re.exec(subject));
+}
+
+var re = /(\w+)@(\w+)\.com/;
+for (var i = 0; i < 5; i++) {
+  check(re, "mail bob@example.com now", ["bob@example.com", "bob", "example"]);
+  check(re, "no address", null);
+  // Two-byte subjects are compiled separately.
+  check(re, "\u1234 al@x.com", ["al@x.com", "al", "x"]);
+}
+
+var global = /a(b)?/g;
+for (var i = 0; i < 5; i++) {
+  assertEquals(["ab", "a", "ab"], "xabyazab".match(global));
+  assertEquals("x-y-z-", "xabyazab".replace(global, "-"));
+  assertEquals("x[b]y[]z[b]",
+               "xabyazab".replace(global, function(m, b) {
+                 return "[" + (b || "") + "]";
+               }));
+  assertEquals(["x", "y", "z", ""], "xabyazab".split(/ab?/));
+}
+
+var backtracking = /^(a|ab)(c|bcd)(d*)$/;
+for (var i = 0; i < 5; i++) {
+  check(backtracking, "abcd", ["abcd", "a", "bcd", ""]);
+}
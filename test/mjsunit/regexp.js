@@ -716,3 +716,19 @@ assertThrows("RegExp.prototype.toString.call(true)", TypeError);
 assertThrows("RegExp.prototype.toString.call([])", TypeError);
 assertThrows("RegExp.prototype.toString.call({})", TypeError);
 assertThrows("RegExp.prototype.toString.call(function(){})", TypeError);
+
+// Test skipping ahead for alternations of literals, where characters of the
+// alternatives also occur in the subject at the wrong offsets.
+var log_re = /error|warn|fatal/;
+assertEquals(7, "eeeeeeeerror".search(log_re));
+assertEquals(4, "oooowarn".search(log_re));
+assertEquals(9, "nawrofetaerrorr".search(log_re));
+assertEquals(-1, "erro warr fata".search(log_re));
+assertEquals(0, "fatal".search(log_re));
+assertEquals(["warn", "error", "fatal"],
+             "xwarnyerrerrorzfatafatal".match(/error|warn|fatal/g));
+var log_line = "";
+for (var i = 0; i < 100; i++) log_line += "info: ok, done. ";
+assertEquals(log_line.length, (log_line + "fatal").search(log_re));
+assertEquals(log_line.length + 1,
+             (log_line + "EwARN").search(/error|warn|fatal/i));
@@ -273,3 +273,21 @@ function testIndices59(re) {
 
 testIndices59(new RegExp(regexp59pattern));
 testIndices59(new RegExp(regexp59pattern, "g"));
+
+// Global regexp replacements with a string without substitution patterns.
+var doc = "";
+for (var i = 0; i < 1000; i++) doc += "line " + i + ": warn\n";
+var replaced = doc.replace(/w[a-z]+/g, "error");
+assertEquals(doc.length + 1000, replaced.length);
+assertEquals("line 0: error\nline 1: error\n", replaced.substr(0, 28));
+assertEquals("warn", RegExp.lastMatch);
+assertEquals(doc.length - 5, RegExp.leftContext.length);
+
+assertEquals("-a-b-c-", "abc".replace(/x*/g, "-"));
+assertEquals("abc", "abc".replace(/x+/g, "-"));
+assertEquals("", "aaa".replace(/a+/g, ""));
+assertEquals("x\u1234x", "ab\u1234cd".replace(/[a-z]+/g, "x"));
+assertEquals("\u1234b\u1234", "aba".replace(/a/g, "\u1234"));
+assertEquals("1b1", "(a)b(a)".replace(/\((a)\)/g, "1"));
+"xaybz".replace(/a(y)b/g, "-");
+assertEquals("y", RegExp.$1);
@@ -34,6 +34,24 @@ TEST(OS, GetCurrentProcessId) {
 }
 
 
+TEST(OS, MemoryMappedFileReadOnly) {
+  const char kFileName[] = "v8-platform-unittest-mmap.bin";
+  char data[] = "snapshot";
+  OS::MemoryMappedFile* file =
+      OS::MemoryMappedFile::create(kFileName, sizeof(data), data);
+  ASSERT_TRUE(file != nullptr);
+  delete file;
+
+  file = OS::MemoryMappedFile::open(
+      kFileName, OS::MemoryMappedFile::FileMode::kReadOnly);
+  ASSERT_TRUE(file != nullptr);
+  EXPECT_EQ(sizeof(data), file->size());
+  EXPECT_STREQ(data, static_cast<const char*>(file->memory()));
+  delete file;
+  EXPECT_TRUE(OS::Remove(kFileName));
+}
+
+
 namespace {
 
 class ThreadLocalStorageTest : public Thread, public ::testing::Test {
@@ -18,6 +18,8 @@
 #include "test/unittests/compiler/node-test-utils.h"
 #include "testing/gmock-support.h"
 
+using testing::_;
+using testing::AllOf;
 using testing::Capture;
 
 
@@ -49,6 +51,47 @@ class JSTypeFeedbackTest : public TypedGraphTest {
     return reducer.Reduce(node);
   }
 
+  typedef Reduction (JSTypeFeedbackSpecializer::*FieldLowering)(
+      Node* node, Handle<Map> map, Handle<Name> name,
+      Node* frame_state_before);
+
+  Reduction Lower(FieldLowering lowering, Node* node, Handle<Map> map,
+                  Handle<Name> name) {
+    Handle<GlobalObject> global_object(
+        isolate()->native_context()->global_object(), isolate());
+
+    MachineOperatorBuilder machine(zone());
+    JSGraph jsgraph(isolate(), graph(), common(), javascript(), &machine);
+    JSTypeFeedbackTable table(zone());
+    GraphReducer graph_reducer(zone(), graph());
+    JSTypeFeedbackSpecializer reducer(
+        &graph_reducer, &jsgraph, &table, nullptr, global_object,
+        JSTypeFeedbackSpecializer::kDeoptimizationEnabled, &dependencies_);
+    return (reducer.*lowering)(node, map, name, jsgraph.EmptyFrameState());
+  }
+
+  // Returns the map of a fresh object with the in-object double field {name}.
+  Handle<Map> MapWithDoubleField(Handle<Name> name) {
+    Handle<JSFunction> function(isolate()->native_context()->object_function(),
+                                isolate());
+    Handle<JSObject> object = factory()->NewJSObject(function);
+    JSObject::SetOwnPropertyIgnoreAttributes(
+        object, name, factory()->NewHeapNumber(1.5), NONE).Check();
+    return handle(object->map(), isolate());
+  }
+
+  Node* StoreNamed(Handle<Name> name, Node* receiver, Node* value) {
+    VectorSlotPair feedback;
+    Node* vector = UndefinedConstant();
+    Node* context = UndefinedConstant();
+    Unique<Name> unique_name = Unique<Name>::CreateUninitialized(name);
+    const Operator* op =
+        javascript()->StoreNamed(SLOPPY, unique_name, feedback);
+    return graph()->NewNode(op, receiver, value, vector, context,
+                            EmptyFrameState(), EmptyFrameState(),
+                            graph()->start(), graph()->start());
+  }
+
   Node* EmptyFrameState() {
     MachineOperatorBuilder machine(zone());
     JSGraph jsgraph(isolate(), graph(), common(), javascript(), &machine);
@@ -339,6 +382,107 @@ TEST_F(JSTypeFeedbackTest,
   dependencies()->Rollback();
 }
 
+
+TEST_F(JSTypeFeedbackTest, JSLoadNamedBoxedDoubleField) {
+  // In-object double fields are only boxed where they cannot be unboxed.
+  if (FLAG_unbox_double_fields) return;
+  Handle<Name> name = factory()->InternalizeUtf8String("boxedLoad");
+  Handle<Map> map = MapWithDoubleField(name);
+
+  VectorSlotPair feedback;
+  Node* receiver = Parameter(Type::Any(), 0);
+  Node* vector = UndefinedConstant();
+  Node* context = UndefinedConstant();
+  Node* load = graph()->NewNode(
+      javascript()->LoadNamed(Unique<Name>::CreateUninitialized(name),
+                              feedback, SLOPPY),
+      receiver, vector, context, EmptyFrameState(), EmptyFrameState(),
+      graph()->start(), graph()->start());
+  Node* ret = graph()->NewNode(common()->Return(), load, load, load);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduction r =
+      Lower(&JSTypeFeedbackSpecializer::LowerLoadNamedField, load, map, name);
+
+  // Check LoadNamed => LoadField[HeapNumber::value](LoadField(receiver))
+  ASSERT_TRUE(r.Changed());
+  Capture<Node*> box;
+  EXPECT_THAT(r.replacement(),
+              IsLoadField(AccessBuilder::ForHeapNumberValue(),
+                          AllOf(CaptureEq(&box),
+                                IsLoadField(_, receiver, graph()->start(), _)),
+                          CaptureEq(&box), _));
+  EXPECT_EQ(kMachAnyTagged, FieldAccessOf(box.value()->op()).machine_type);
+}
+
+
+TEST_F(JSTypeFeedbackTest, JSStoreNamedBoxedDoubleField) {
+  // In-object double fields are only boxed where they cannot be unboxed.
+  if (FLAG_unbox_double_fields) return;
+  Handle<Name> name = factory()->InternalizeUtf8String("boxedStore");
+  Handle<Map> map = MapWithDoubleField(name);
+
+  Node* receiver = Parameter(Type::Any(), 0);
+  Node* value = Parameter(Type::Number(), 1);
+  Node* store = StoreNamed(name, receiver, value);
+  Node* ret = graph()->NewNode(common()->Return(), UndefinedConstant(), store,
+                               store);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduction r =
+      Lower(&JSTypeFeedbackSpecializer::LowerStoreNamedField, store, map, name);
+
+  // Check StoreNamed => StoreField[HeapNumber::value](box, value), where the
+  // MutableHeapNumber box is loaded from the receiver and updated in place.
+  ASSERT_TRUE(r.Changed());
+  Capture<Node*> box;
+  EXPECT_THAT(r.replacement(),
+              IsStoreField(AccessBuilder::ForHeapNumberValue(),
+                           AllOf(CaptureEq(&box),
+                                 IsLoadField(_, receiver, graph()->start(), _)),
+                           value, CaptureEq(&box), _));
+}
+
+
+TEST_F(JSTypeFeedbackTest, JSStoreNamedUnboxedDoubleField) {
+  if (!FLAG_unbox_double_fields) return;
+  Handle<Name> name = factory()->InternalizeUtf8String("unboxedStore");
+  Handle<Map> map = MapWithDoubleField(name);
+
+  Node* receiver = Parameter(Type::Any(), 0);
+  Node* value = Parameter(Type::Number(), 1);
+  Node* store = StoreNamed(name, receiver, value);
+  Node* ret = graph()->NewNode(common()->Return(), UndefinedConstant(), store,
+                               store);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduction r =
+      Lower(&JSTypeFeedbackSpecializer::LowerStoreNamedField, store, map, name);
+
+  // Check StoreNamed => StoreField[kMachFloat64](receiver, value)
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(),
+              IsStoreField(_, receiver, value, graph()->start(), _));
+  EXPECT_EQ(kMachFloat64, FieldAccessOf(r.replacement()->op()).machine_type);
+}
+
+
+TEST_F(JSTypeFeedbackTest, JSStoreNamedDoubleFieldWithUntypedValue) {
+  Handle<Name> name = factory()->InternalizeUtf8String("untypedStore");
+  Handle<Map> map = MapWithDoubleField(name);
+
+  Node* receiver = Parameter(Type::Any(), 0);
+  Node* value = Parameter(Type::Any(), 1);
+  Node* store = StoreNamed(name, receiver, value);
+  Node* ret = graph()->NewNode(common()->Return(), UndefinedConstant(), store,
+                               store);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduction r =
+      Lower(&JSTypeFeedbackSpecializer::LowerStoreNamedField, store, map, name);
+  EXPECT_FALSE(r.Changed());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8